@@ -0,0 +1,856 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the batch command mode declared in
+//   batchCommands.h. Each command checks its arguments the way
+//   the matching menu does, then calls the same core function.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial batch command mode.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Commands call the headless libfrss functions, which
+//            never print, so cout is no longer silenced.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Added the stats command.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - Added the io command.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - Added the audit command.
+//************************************************************
+
+#include "batchCommands.h"
+#include "ui.h"
+#include "sailing.h"
+#include "sailingFileIO.h"
+#include "vehicle.h"
+#include "vehicleFileIO.h"
+#include "reservation.h"
+#include "revenueReport.h"
+#include "operationTrace.h"
+#include "latencyStats.h"
+#include "ioStats.h"
+#include "storeAudit.h"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+//--------------------------------------------------
+// Limits shared with the menus
+const size_t PLATE_SEARCH_LIMIT = 20;
+const int PLATE_SEARCH_DISTANCE = 2;
+
+// Arguments after the command name
+typedef vector<string> Args;
+
+// Runs a command; writes row and ok lines to 'out', or sets
+// 'error' and returns false
+typedef bool (*CommandHandler)(const Args &args, ostream &out, string &error);
+
+//--------------------------------------------------
+// One batch command
+struct BatchCommand
+{
+    const char *name;       // first word of the line
+    const char *usage;      // arguments, for help and errors
+    size_t minArgs;         // fewest arguments accepted
+    size_t maxArgs;         // most arguments accepted
+    CommandHandler handler; // does the work
+};
+
+//--------------------------------------------------
+// Function: result
+//--------------------------------------------------
+// Starts a result line: status and command name.
+static ostream &result(ostream &out, const char *status, const char *command)
+{
+    return out << status << '\t' << command;
+}
+
+//--------------------------------------------------
+// Function: dollars
+//--------------------------------------------------
+// Formats a fare as dollars with two decimals.
+static string dollars(double amount)
+{
+    ostringstream text;
+    text << fixed << setprecision(2) << amount;
+    return text.str();
+}
+
+//--------------------------------------------------
+// Function: parseDimension
+//--------------------------------------------------
+// Reads a positive length or height in meters.
+static bool parseDimension(const string &text, float &value)
+{
+    char *end = NULL;
+    value = strtof(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && value > 0.0f;
+}
+
+//--------------------------------------------------
+// Function: parseInt
+//--------------------------------------------------
+// Reads a whole number between min and max.
+static bool parseInt(const string &text, int min, int max, int &value)
+{
+    char *end = NULL;
+    long parsed = strtol(text.c_str(), &end, 10);
+    if (text.empty() || *end != '\0' || parsed < min || parsed > max)
+        return false;
+    value = static_cast<int>(parsed);
+    return true;
+}
+
+//--------------------------------------------------
+// Function: checkSailingID / checkPlate
+//--------------------------------------------------
+// Set 'error' and return false if the argument is malformed.
+static bool checkSailingID(const string &id, string &error)
+{
+    if (!UI::isValidSailingID(id))
+        error = "invalid sailing ID " + id + " (expected AAA-NN-NN)";
+    return error.empty();
+}
+
+static bool checkPlate(const string &plate, string &error)
+{
+    if (!UI::isValidLicensePlate(plate))
+        error = "invalid license plate " + plate + " (1-10 letters or digits)";
+    return error.empty();
+}
+
+//--------------------------------------------------
+// Function: checkSailing
+//--------------------------------------------------
+// Checks the sailing ID and that the sailing exists.
+static bool checkSailing(const string &id, string &error)
+{
+    if (!checkSailingID(id, error))
+        return false;
+    if (!sailingFileIO::exists(id.c_str()))
+        error = "no sailing " + id;
+    return error.empty();
+}
+
+//--------------------------------------------------
+// Function: checkLaneLimits
+//--------------------------------------------------
+// Reads and checks a vessel ID, LCLL and HCLL.
+static bool checkLaneLimits(const string &vessel, const string &lcllText, const string &hcllText,
+                            int &lcll, int &hcll, string &error)
+{
+    if (vessel.empty() || vessel.size() > VESSEL_ID_MAX)
+        error = "invalid vessel ID " + vessel + " (1-25 characters)";
+    else if (!parseInt(lcllText, 0, LANE_LIMIT_MAX, lcll))
+        error = "invalid LCLL " + lcllText + " (0-9999)";
+    else if (!parseInt(hcllText, 0, LANE_LIMIT_MAX, hcll))
+        error = "invalid HCLL " + hcllText + " (0-9999)";
+    return error.empty();
+}
+
+//--------------------------------------------------
+// Function: writeSailingFields
+//--------------------------------------------------
+// Appends a sailing's fields to a result line.
+static void writeSailingFields(ostream &out, const Sailing &s)
+{
+    out << '\t' << s.getSailingID() << '\t' << s.getVesselID()
+        << '\t' << s.getLCLL() << '\t' << s.getHCLL()
+        << '\t' << s.getLRL() << '\t' << s.getHRL()
+        << '\t' << s.getReservedCount() << '\t' << s.getOnboardCount()
+        << '\t' << s.getSpecialCount() << '\t' << dollars(s.getRevenue());
+}
+
+// add-sailing SAILING_ID VESSEL LCLL HCLL
+static bool addSailingCommand(const Args &args, ostream &out, string &error)
+{
+    int lcll, hcll;
+    if (!checkSailingID(args[0], error) ||
+        !checkLaneLimits(args[1], args[2], args[3], lcll, hcll, error))
+        return false;
+
+    bool saved;
+    {
+        TraceScope trace("addSailing");
+        trace.arg(args[0]).arg(args[1]).arg(lcll).arg(hcll);
+        saved = Sailing::addSailing(args[0].c_str(), args[1], lcll, hcll);
+    }
+    if (!saved)
+    {
+        error = "sailing " + args[0] + " already exists or could not be saved";
+        return false;
+    }
+    result(out, "ok", "add-sailing") << '\t' << args[0] << '\n';
+    return true;
+}
+
+// edit-sailing SAILING_ID NEW_SAILING_ID VESSEL LCLL HCLL
+static bool editSailingCommand(const Args &args, ostream &out, string &error)
+{
+    int lcll, hcll;
+    if (!checkSailing(args[0], error) || !checkSailingID(args[1], error) ||
+        !checkLaneLimits(args[2], args[3], args[4], lcll, hcll, error))
+        return false;
+
+    bool saved;
+    {
+        TraceScope trace("editSailing");
+        trace.arg(args[0]).arg(args[1]).arg(args[2]).arg(lcll).arg(hcll);
+        saved = Sailing::applyEdit(args[0].c_str(), args[1].c_str(), args[2], lcll, hcll);
+    }
+    if (!saved)
+    {
+        error = "sailing " + args[1] + " already exists or cannot hold the reservations";
+        return false;
+    }
+    result(out, "ok", "edit-sailing") << '\t' << args[1] << '\n';
+    return true;
+}
+
+// delete-sailing SAILING_ID
+static bool deleteSailingCommand(const Args &args, ostream &out, string &error)
+{
+    if (!checkSailing(args[0], error))
+        return false;
+
+    int cancelled;
+    {
+        TraceScope trace("deleteSailing");
+        trace.arg(args[0]);
+        cancelled = Sailing::deleteWithReservations(args[0].c_str());
+    }
+    if (cancelled < 0)
+    {
+        error = "sailing " + args[0] + " could not be deleted";
+        return false;
+    }
+    result(out, "ok", "delete-sailing") << '\t' << args[0] << '\t' << cancelled << '\n';
+    return true;
+}
+
+// sailing SAILING_ID
+static bool sailingCommand(const Args &args, ostream &out, string &error)
+{
+    if (!checkSailing(args[0], error))
+        return false;
+    writeSailingFields(result(out, "ok", "sailing"), Sailing::getSailingFromIO(args[0].c_str()));
+    out << '\n';
+    return true;
+}
+
+// report [PAGE]
+static bool reportCommand(const Args &args, ostream &out, string &error)
+{
+    SailingCursor cursor(REPORT_PAGE_SIZE);
+    int page = 1;
+    if (!args.empty() && (!parseInt(args[0], 1, LANE_LIMIT_MAX * 100, page) ||
+                          !cursor.seekPage(static_cast<size_t>(page - 1))))
+    {
+        error = "no page " + args[0] + " (1-" + to_string(cursor.pageCount()) + ")";
+        return false;
+    }
+
+    TraceScope trace("displayReport");
+    trace.arg(cursor.currentPage());
+    const vector<SailingReportRow> &rows = sailingFileIO::reportRows();
+    // Loop goal: Write each sailing on the requested page
+    for (size_t i = cursor.begin(); i < cursor.end(); i++)
+    {
+        writeSailingFields(result(out, "row", "report"), rows[i].sailing);
+        out << '\t' << fixed << setprecision(1) << rows[i].percentFull << '\n';
+        out.unsetf(ios::fixed);
+        out << setprecision(6);
+    }
+    result(out, "ok", "report") << '\t' << page << '\t' << cursor.pageCount() << '\n';
+    return true;
+}
+
+// query [terminal=AAA] [day=N] [from=H] [to=H] [vessel=V]
+//       [order=file|full|lrl|hrl] [asc|desc] [limit=N]
+static bool queryCommand(const Args &args, ostream &out, string &error)
+{
+    SailingQuery q;
+    int limit = 0;
+    // Loop goal: Apply each filter or ordering option
+    for (const auto &option : args)
+    {
+        size_t equals = option.find('=');
+        string key = option.substr(0, equals);
+        string value = equals == string::npos ? string() : option.substr(equals + 1);
+        bool valid = true;
+        if (key == "asc" || key == "desc")
+            q.descending = key == "desc";
+        else if (key == "terminal")
+            q.terminal = value;
+        else if (key == "vessel")
+            q.vessel = value;
+        else if (key == "day")
+            valid = parseInt(value, 1, 31, q.day);
+        else if (key == "from")
+            valid = parseInt(value, 0, 23, q.fromHour);
+        else if (key == "to")
+            valid = parseInt(value, 0, 23, q.toHour);
+        else if (key == "limit")
+            valid = parseInt(value, 1, 100000, limit);
+        else if (key == "order" && value == "file")
+            q.order = ORDER_FILE;
+        else if (key == "order" && value == "full")
+            q.order = ORDER_PERCENT_FULL;
+        else if (key == "order" && value == "lrl")
+            q.order = ORDER_LRL;
+        else if (key == "order" && value == "hrl")
+            q.order = ORDER_HRL;
+        else
+            valid = false;
+        if (!valid)
+        {
+            error = "invalid option " + option;
+            return false;
+        }
+    }
+    q.limit = static_cast<size_t>(limit);
+
+    vector<size_t> matches;
+    {
+        TraceScope trace("queryReport");
+        trace.arg(q.terminal).arg(q.day).arg(q.fromHour).arg(q.toHour).arg(q.vessel)
+             .arg(static_cast<int>(q.order)).arg(q.descending).arg(q.limit);
+        matches = sailingFileIO::query(q);
+    }
+    const vector<SailingReportRow> &rows = sailingFileIO::reportRows();
+    // Loop goal: Write each matching sailing in ranked order
+    for (size_t i : matches)
+    {
+        writeSailingFields(result(out, "row", "query"), rows[i].sailing);
+        out << '\t' << fixed << setprecision(1) << rows[i].percentFull << '\n';
+        out.unsetf(ios::fixed);
+        out << setprecision(6);
+    }
+    result(out, "ok", "query") << '\t' << matches.size() << '\n';
+    return true;
+}
+
+// add-vehicle PLATE PHONE LENGTH HEIGHT
+static bool addVehicleCommand(const Args &args, ostream &out, string &error)
+{
+    float length, height;
+    if (!checkPlate(args[0], error))
+        return false;
+    if (!UI::isValidPhoneNumber(args[1]))
+        error = "invalid phone number " + args[1] + " (10 digits)";
+    else if (!parseDimension(args[2], length))
+        error = "invalid length " + args[2];
+    else if (!parseDimension(args[3], height))
+        error = "invalid height " + args[3];
+    if (!error.empty())
+        return false;
+
+    Vehicle vehicle;
+    bool added;
+    {
+        TraceScope trace("addVehicle");
+        trace.arg(args[0]).arg(args[1]).arg(length).arg(height);
+        added = vehicle.addVehicle(args[0].c_str(), args[1].c_str(), length, height);
+    }
+    if (!added)
+    {
+        error = "vehicle " + args[0] + " already exists or could not be saved";
+        return false;
+    }
+    result(out, "ok", "add-vehicle") << '\t' << args[0] << '\t' << (vehicle.isSpecial() ? 1 : 0) << '\n';
+    return true;
+}
+
+// delete-vehicle PLATE
+static bool deleteVehicleCommand(const Args &args, ostream &out, string &error)
+{
+    if (!checkPlate(args[0], error))
+        return false;
+    bool deleted;
+    {
+        TraceScope trace("deleteVehicle");
+        trace.arg(args[0]);
+        deleted = deleteVehicle(args[0]);
+    }
+    if (!deleted)
+    {
+        error = "no vehicle " + args[0];
+        return false;
+    }
+    result(out, "ok", "delete-vehicle") << '\t' << args[0] << '\n';
+    return true;
+}
+
+// reserve SAILING_ID PLATE PHONE [LENGTH HEIGHT]
+static bool reserveCommand(const Args &args, ostream &out, string &error)
+{
+    if (!checkSailing(args[0], error) || !checkPlate(args[1], error))
+        return false;
+    if (!UI::isValidPhoneNumber(args[2]))
+    {
+        error = "invalid phone number " + args[2] + " (10 digits)";
+        return false;
+    }
+
+    // A registered vehicle books with its own dimensions; a new
+    // one is registered first, as in Add Reservation
+    FileIOforVehicle vehicleIO;
+    if (!vehicleIO.open())
+    {
+        error = "vehicle data unavailable";
+        return false;
+    }
+    Vehicle vehicle;
+    string phone;
+    bool registered = vehicleIO.getVehicleWithData(args[1], vehicle, phone);
+    if (!registered)
+    {
+        float length, height;
+        if (args.size() < 5)
+            error = "vehicle " + args[1] + " is not registered; give LENGTH HEIGHT";
+        else if (!parseDimension(args[3], length))
+            error = "invalid length " + args[3];
+        else if (!parseDimension(args[4], height))
+            error = "invalid height " + args[4];
+        if (!error.empty())
+        {
+            vehicleIO.close();
+            return false;
+        }
+        TraceScope trace("addVehicle");
+        trace.arg(args[1]).arg(args[2]).arg(length).arg(height);
+        vehicle.initialize(args[1].c_str(), args[2].c_str(), length, height);
+        if (!vehicleIO.saveVehicleWithData(vehicle, args[1], args[2]))
+        {
+            vehicleIO.close();
+            error = "vehicle " + args[1] + " could not be saved";
+            return false;
+        }
+    }
+    vehicleIO.close();
+
+    bool booked;
+    {
+        TraceScope trace("addReservation");
+        trace.arg(args[0]).arg(args[1]).arg(args[2]).arg(vehicle.isSpecial())
+             .arg(vehicle.getHeight()).arg(vehicle.getLength());
+        booked = addReservation(args[0], args[1], args[2], vehicle.isSpecial(),
+                                vehicle.getHeight(), vehicle.getLength());
+    }
+    if (!booked)
+    {
+        error = "vehicle " + args[1] + " is already booked or sailing " + args[0] + " is full";
+        return false;
+    }
+    result(out, "ok", "reserve") << '\t' << args[0] << '\t' << args[1]
+                                 << '\t' << (vehicle.isSpecial() ? 1 : 0) << '\n';
+    return true;
+}
+
+// reserve-group SAILING_ID PLATE...
+static bool reserveGroupCommand(const Args &args, ostream &out, string &error)
+{
+    if (!checkSailing(args[0], error))
+        return false;
+    vector<string> plates(args.begin() + 1, args.end());
+
+    unordered_map<string, Vehicle> vehicles;
+    FileIOforVehicle vehicleIO;
+    if (vehicleIO.open())
+    {
+        vehicles = vehicleIO.getVehicles(plates);
+        vehicleIO.close();
+    }
+
+    vector<GroupVehicle> members;
+    // Loop goal: Look up each plate's dimensions, stopping at the first unknown plate
+    for (const auto &p : plates)
+    {
+        unordered_map<string, Vehicle>::const_iterator v = vehicles.find(p);
+        if (v == vehicles.end())
+        {
+            error = "vehicle " + p + " is not registered";
+            return false;
+        }
+        GroupVehicle member;
+        member.licensePlate = p;
+        member.isSpecial = v->second.isSpecial();
+        member.height = v->second.getHeight();
+        member.length = v->second.getLength();
+        members.push_back(member);
+    }
+
+    bool booked;
+    {
+        TraceScope trace("addGroupReservation");
+        trace.arg(args[0]);
+        // Loop goal: Add each member's plate, type and dimensions
+        for (const auto &member : members)
+        {
+            trace.arg(member.licensePlate).arg(member.isSpecial).arg(member.height).arg(member.length);
+        }
+        booked = addGroupReservation(args[0], members);
+    }
+    if (!booked)
+    {
+        error = "a vehicle is already booked or sailing " + args[0] + " lacks space";
+        return false;
+    }
+    result(out, "ok", "reserve-group") << '\t' << args[0] << '\t' << members.size() << '\n';
+    return true;
+}
+
+// cancel SAILING_ID PLATE
+static bool cancelCommand(const Args &args, ostream &out, string &error)
+{
+    if (!checkSailingID(args[0], error) || !checkPlate(args[1], error))
+        return false;
+    bool cancelled;
+    {
+        TraceScope trace("cancelReservation");
+        trace.arg(args[0]).arg(args[1]);
+        cancelled = cancelReservation(args[0], args[1]);
+    }
+    if (!cancelled)
+    {
+        error = "no reservation for " + args[1] + " on " + args[0];
+        return false;
+    }
+    result(out, "ok", "cancel") << '\t' << args[0] << '\t' << args[1] << '\n';
+    return true;
+}
+
+// check-in SAILING_ID PLATE...
+static bool checkInCommand(const Args &args, ostream &out, string &error)
+{
+    if (!checkSailingID(args[0], error))
+        return false;
+    vector<string> plates(args.begin() + 1, args.end());
+
+    vector<CheckInResult> results;
+    {
+        TraceScope trace("checkInBatch");
+        trace.arg(args[0]);
+        // Loop goal: Add each plate in lane order
+        for (const auto &p : plates)
+        {
+            trace.arg(p);
+        }
+        results = checkInBatch(args[0], plates);
+    }
+
+    size_t checkedIn = 0;
+    double total = 0.0;
+    // Loop goal: Write the outcome for each plate in lane order
+    for (const auto &r : results)
+    {
+        result(out, "row", "check-in") << '\t' << r.licensePlate << '\t';
+        if (r.error.empty())
+        {
+            out << dollars(r.fare) << '\n';
+            ++checkedIn;
+            total += r.fare;
+        }
+        else
+        {
+            out << "-\t" << r.error << '\n';
+        }
+    }
+    if (checkedIn == 0)
+    {
+        error = "no vehicle was checked in";
+        return false;
+    }
+    result(out, "ok", "check-in") << '\t' << args[0] << '\t' << checkedIn << '\t'
+                                  << results.size() << '\t' << dollars(total) << '\n';
+    return true;
+}
+
+// manifest SAILING_ID
+static bool manifestCommand(const Args &args, ostream &out, string &error)
+{
+    if (!checkSailing(args[0], error))
+        return false;
+    vector<ManifestRow> manifest;
+    {
+        TraceScope trace("getManifest");
+        trace.arg(args[0]);
+        FileIOforVehicle vehicleIO;
+        vehicleIO.open();
+        manifest = vehicleIO.getManifest(args[0]);
+        vehicleIO.close();
+    }
+    // Loop goal: Write each reservation with its vehicle's details
+    for (const auto &row : manifest)
+    {
+        result(out, "row", "manifest") << '\t' << row.licensePlate << '\t' << (row.onboard ? 1 : 0)
+                                       << '\t' << row.phone << '\t' << (row.isSpecial ? 1 : 0)
+                                       << '\t' << row.length << '\t' << row.height << '\n';
+    }
+    result(out, "ok", "manifest") << '\t' << args[0] << '\t' << manifest.size() << '\n';
+    return true;
+}
+
+// find-phone PHONE
+static bool findPhoneCommand(const Args &args, ostream &out, string &error)
+{
+    vector<string> plates;
+    vector<ReservationRecord> upcoming;
+    {
+        TraceScope trace("findByPhone");
+        trace.arg(args[0]);
+        FileIOforVehicle vehicleIO;
+        if (!vehicleIO.open())
+        {
+            error = "vehicle data unavailable";
+            return false;
+        }
+        plates = vehicleIO.getPlatesForPhone(args[0]);
+        upcoming = vehicleIO.getUpcomingForPhone(args[0]);
+        vehicleIO.close();
+    }
+    // Loop goal: Write each vehicle registered to the phone
+    for (const auto &p : plates)
+    {
+        result(out, "row", "find-phone") << "\tvehicle\t" << p << '\n';
+    }
+    // Loop goal: Write each booking not yet checked in
+    for (const auto &r : upcoming)
+    {
+        result(out, "row", "find-phone") << "\tbooking\t" << r.licensePlate << '\t' << r.sailingID << '\n';
+    }
+    result(out, "ok", "find-phone") << '\t' << plates.size() << '\t' << upcoming.size() << '\n';
+    return true;
+}
+
+// search-plates PARTIAL
+static bool searchPlatesCommand(const Args &args, ostream &out, string &error)
+{
+    vector<string> starting;
+    vector<PlateMatch> similar;
+    {
+        TraceScope trace("searchPlates");
+        trace.arg(args[0]).arg(PLATE_SEARCH_LIMIT).arg(PLATE_SEARCH_DISTANCE);
+        FileIOforVehicle vehicleIO;
+        if (!vehicleIO.open())
+        {
+            error = "vehicle data unavailable";
+            return false;
+        }
+        starting = vehicleIO.findPlatesWithPrefix(args[0], PLATE_SEARCH_LIMIT);
+        similar = vehicleIO.findSimilarPlates(args[0], PLATE_SEARCH_DISTANCE, PLATE_SEARCH_LIMIT);
+        vehicleIO.close();
+    }
+    // Loop goal: Write the plates starting with the text
+    for (const auto &p : starting)
+    {
+        result(out, "row", "search-plates") << "\tprefix\t" << p << '\n';
+    }
+    // Loop goal: Write the plates within the edit distance
+    for (const auto &m : similar)
+    {
+        result(out, "row", "search-plates") << "\tsimilar\t" << m.licensePlate << '\t' << m.distance << '\n';
+    }
+    result(out, "ok", "search-plates") << '\t' << starting.size() << '\t' << similar.size() << '\n';
+    return true;
+}
+
+// revenue
+static bool revenueCommand(const Args &, ostream &out, string &)
+{
+    RevenueReport report;
+    {
+        TraceScope trace("revenueReport");
+        report = buildRevenueReport();
+    }
+    // Loop goal: Write each sailing's booked and collected fares
+    for (const auto &s : report.sailings)
+    {
+        result(out, "row", "revenue") << "\tsailing\t" << s.sailingID << '\t' << s.vehicles << '\t'
+                                      << dollars(s.bookedCents / 100.0) << '\t'
+                                      << dollars(s.collectedCents / 100.0) << '\n';
+    }
+    // Loop goal: Write each day's booked fares
+    for (const auto &d : report.days)
+    {
+        result(out, "row", "revenue") << "\tday\t" << d.day << '\t' << d.vehicles << '\t'
+                                      << dollars(d.bookedCents / 100.0) << '\n';
+    }
+    result(out, "ok", "revenue") << '\t' << dollars(report.totalCents / 100.0) << '\n';
+    return true;
+}
+
+// stats [reset]
+static bool statsCommand(const Args &args, ostream &out, string &error)
+{
+    if (!args.empty() && args[0] != "reset")
+    {
+        error = "expected reset";
+        return false;
+    }
+    vector<LatencySnapshot> snapshots = latencySnapshots();
+    // Loop goal: Write each operation's counts and latencies in microseconds
+    for (const auto &s : snapshots)
+    {
+        result(out, "row", "stats") << '\t' << s.name << '\t' << s.calls << '\t' << s.errors << fixed
+                                    << setprecision(1) << '\t' << s.meanMicros()
+                                    << '\t' << s.percentileMicros(0.50) << '\t' << s.percentileMicros(0.90)
+                                    << '\t' << s.percentileMicros(0.99) << '\t' << s.percentileMicros(0.999)
+                                    << '\t' << s.maxNanos / 1000.0 << '\n';
+    }
+    if (!args.empty())
+        resetLatencyStats();
+    result(out, "ok", "stats") << '\t' << snapshots.size() << '\n';
+    return true;
+}
+
+// io [reset]
+static bool ioCommand(const Args &args, ostream &out, string &error)
+{
+    if (!args.empty() && args[0] != "reset")
+    {
+        error = "expected reset";
+        return false;
+    }
+    vector<pair<string, IOCounts> > snapshots = ioSnapshots();
+    // Loop goal: Write each top-level operation's storage I/O counts
+    for (const auto &entry : snapshots)
+    {
+        ostream &line = result(out, "row", "io") << '\t' << entry.first;
+        // Loop goal: Write each counter in order
+        for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+        {
+            line << '\t' << entry.second.value[i];
+        }
+        line << '\n';
+    }
+    if (!args.empty())
+        resetIOStats();
+    result(out, "ok", "io") << '\t' << snapshots.size() << '\n';
+    return true;
+}
+
+// audit [repair]
+static bool auditCommand(const Args &args, ostream &out, string &error)
+{
+    if (!args.empty() && args[0] != "repair")
+    {
+        error = "expected repair";
+        return false;
+    }
+    StoreAudit audit = auditStores(!args.empty());
+    // Loop goal: Write each sailing whose counters disagree with its reservations
+    for (const auto &sailingID : audit.mismatched)
+    {
+        result(out, "row", "audit") << "\tmismatch\t" << sailingID << '\n';
+    }
+    result(out, "ok", "audit") << '\t' << audit.sailings << '\t' << audit.reservations << '\t'
+                               << audit.badReservations << '\t' << audit.orphans << '\t'
+                               << audit.mismatched.size() << '\t' << audit.repaired << '\n';
+    return true;
+}
+
+static bool helpCommand(const Args &args, ostream &out, string &error);
+
+//--------------------------------------------------
+// Every command, in help order
+static const BatchCommand COMMANDS[] = {
+    {"add-sailing", "SAILING_ID VESSEL LCLL HCLL", 4, 4, addSailingCommand},
+    {"edit-sailing", "SAILING_ID NEW_SAILING_ID VESSEL LCLL HCLL", 5, 5, editSailingCommand},
+    {"delete-sailing", "SAILING_ID", 1, 1, deleteSailingCommand},
+    {"sailing", "SAILING_ID", 1, 1, sailingCommand},
+    {"report", "[PAGE]", 0, 1, reportCommand},
+    {"query", "[terminal=AAA] [day=N] [from=H] [to=H] [vessel=V] [order=file|full|lrl|hrl] [asc|desc] [limit=N]",
+     0, 8, queryCommand},
+    {"add-vehicle", "PLATE PHONE LENGTH HEIGHT", 4, 4, addVehicleCommand},
+    {"delete-vehicle", "PLATE", 1, 1, deleteVehicleCommand},
+    {"reserve", "SAILING_ID PLATE PHONE [LENGTH HEIGHT]", 3, 5, reserveCommand},
+    {"reserve-group", "SAILING_ID PLATE...", 2, 1000, reserveGroupCommand},
+    {"cancel", "SAILING_ID PLATE", 2, 2, cancelCommand},
+    {"check-in", "SAILING_ID PLATE...", 2, 1000, checkInCommand},
+    {"manifest", "SAILING_ID", 1, 1, manifestCommand},
+    {"find-phone", "PHONE", 1, 1, findPhoneCommand},
+    {"search-plates", "PARTIAL", 1, 1, searchPlatesCommand},
+    {"revenue", "", 0, 0, revenueCommand},
+    {"stats", "[reset]", 0, 1, statsCommand},
+    {"io", "[reset]", 0, 1, ioCommand},
+    {"audit", "[repair]", 0, 1, auditCommand},
+    {"help", "", 0, 0, helpCommand},
+};
+const size_t COMMAND_COUNT = sizeof(COMMANDS) / sizeof(COMMANDS[0]);
+
+// help
+static bool helpCommand(const Args &, ostream &out, string &)
+{
+    // Loop goal: Write each command with its arguments
+    for (size_t i = 0; i < COMMAND_COUNT; ++i)
+    {
+        result(out, "row", "help") << '\t' << COMMANDS[i].name << '\t' << COMMANDS[i].usage << '\n';
+    }
+    result(out, "ok", "help") << '\t' << COMMAND_COUNT << '\n';
+    return true;
+}
+
+bool runCommand(const string &line, ostream &out)
+{
+    istringstream words(line);
+    string name;
+    if (!(words >> name) || name[0] == '#')
+        return true;
+    Args args;
+    string word;
+    // Loop goal: Collect the arguments after the command name
+    while (words >> word)
+    {
+        args.push_back(word);
+    }
+
+    const BatchCommand *command = NULL;
+    // Loop goal: Find the command by name
+    for (size_t i = 0; i < COMMAND_COUNT && command == NULL; ++i)
+    {
+        if (name == COMMANDS[i].name)
+            command = &COMMANDS[i];
+    }
+
+    string error;
+    bool ok = false;
+    if (command == NULL)
+    {
+        error = "unknown command (try help)";
+    }
+    else if (args.size() < command->minArgs || args.size() > command->maxArgs)
+    {
+        error = string("usage: ") + command->name + " " + command->usage;
+    }
+    else
+    {
+        ok = command->handler(args, out, error);
+    }
+    if (!ok)
+        result(out, "error", name.c_str()) << '\t' << error << '\n';
+    out.flush();
+    return ok;
+}
+
+size_t runBatch(istream &in, ostream &out)
+{
+    size_t failed = 0;
+    string line;
+    // Loop goal: Run each command line until the input ends
+    while (getline(in, line))
+    {
+        if (!runCommand(line, out))
+            ++failed;
+    }
+    return failed;
+}
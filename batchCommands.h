@@ -0,0 +1,64 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the batch command mode: a non-interactive front end
+//   that reads one command per line and calls the sailing,
+//   vehicle and reservation modules directly, with no menus or
+//   prompts, so scripts can drive the system.
+//************************************************************
+// USAGE:
+// - ferry_system --batch [FILE]   commands from FILE (or stdin)
+// - ferry_system -c "COMMAND ARG..." [-c ...]   commands from argv
+// - Initialize the sailing and reservation modules before
+//   calling runBatch() or runCommand(), and shut them down after.
+// - One command per line, words separated by spaces. Blank lines
+//   and lines starting with '#' are skipped. "help" lists the
+//   commands and their arguments.
+//
+// Output: one tab-separated line per result, flushed after each
+// command so a script can wait for its answer:
+//   ok     COMMAND  value...   the command succeeded
+//   error  COMMAND  reason     the command failed, nothing changed
+//   row    COMMAND  value...   one row of a listing, before its ok
+// Lengths and heights are in meters, LENGTH before HEIGHT; fares
+// are dollars with two decimals. The commands call the libfrss
+// core, which never writes to cout, so 'out' carries only the
+// result lines.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial batch command mode.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Results no longer need cout silenced.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef BATCH_COMMANDS_H
+#define BATCH_COMMANDS_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+
+//--------------------------------------------------
+// Runs one command line and writes its result lines to 'out'.
+// Blank and comment lines write nothing and count as success.
+// Returns false if the command failed.
+bool runCommand(
+    const std::string &line, // in:  command and its arguments
+    std::ostream &out        // out: result lines
+);
+
+//--------------------------------------------------
+// Runs every command line read from 'in' until end of input.
+// Returns the number of commands that failed.
+size_t runBatch(
+    std::istream &in, // in:  command lines
+    std::ostream &out // out: result lines
+);
+
+#endif // BATCH_COMMANDS_H
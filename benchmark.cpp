@@ -0,0 +1,671 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Microbenchmarks for every public function of the sailing,
+//   vehicle and reservation stores, plus addReservation(),
+//   checkIn() and moveReservations(). Each store is filled with
+//   N records and every operation is timed call by call.
+//   Where Linux allows it, each operation also reports cycles,
+//   instructions, IPC, cache misses and branch misses per call
+//   (perfCounters.h), so layout and SIMD changes can be judged
+//   on more than wall time.
+//************************************************************
+// USAGE:
+// - make bench                       (N = 1000, 100000, 1000000)
+// - make bench BENCH_SIZES="1000"    (choose the sizes)
+// - ./ferry_bench 1000 100000        (run the built harness)
+// - Data files are written under bench_data/, never over the
+//   real ones. Reports ns/op, ops/s, p50 and p99 per operation.
+// - Hardware counters need a CPU PMU and perf_event_paranoid <= 2
+//   (or CAP_PERFMON); without them the counter columns are left
+//   out and the reason is printed.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial FileIO and reservation benchmark harness.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Added hardware counters per operation.
+//          - Added fare kernel and revenue report benchmarks.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - populate() replaces the vehicle file through bulkLoad(),
+//            which drops the phone index and plate trie of the
+//            previous size.
+//************************************************************
+
+#include "sailing.h"
+#include "sailingFileIO.h"
+#include "vehicle.h"
+#include "vehicleFileIO.h"
+#include "reservation.h"
+#include "reservationFileIO.h"
+#include "revenueReport.h"
+#include "perfCounters.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+//--------------------------------------------------
+// Scratch directory the benchmark runs in
+const char *BENCH_DIR = "bench_data";
+const char *RESERVATION_FILE = "reservation.dat";
+
+// Reservations per booked sailing
+const size_t BOOKINGS_PER_SAILING = 10;
+
+// Point operations run this many times (at most N)
+const size_t POINT_ITERATIONS = 1000;
+
+// Whole-file operations get about this many records of work,
+// split into at least MIN_SCAN_ITERATIONS calls
+const size_t SCAN_BUDGET = 200000;
+const size_t MIN_SCAN_ITERATIONS = 5;
+
+// Records written per batch call
+const size_t BATCH_SIZE = 100;
+
+// Hardware counters of the benchmark thread, if any could be opened
+static PerfCounters *counters = NULL;
+
+//--------------------------------------------------
+// Timings of one operation at one store size
+struct BenchResult
+{
+    string name;       // Operation
+    size_t iterations; // Timed calls
+    double nsPerOp;    // Mean nanoseconds per call
+    double opsPerSec;  // Calls per second at the mean
+    double p50;        // Median nanoseconds
+    double p99;        // 99th percentile nanoseconds
+    PerfCounts perf;   // Hardware counts over all timed calls
+};
+
+//--------------------------------------------------
+// Function: measure
+//--------------------------------------------------
+// Calls prepare(i) untimed and then body(i) timed, for each i in
+// [0, iterations), and summarises the body timings.
+static BenchResult measure(const string &name, size_t iterations,
+                           const function<void(size_t)> &prepare,
+                           const function<void(size_t)> &body)
+{
+    typedef chrono::steady_clock Clock;
+    vector<double> samples;
+    samples.reserve(iterations);
+    if (counters != NULL)
+        counters->reset();
+    // Loop goal: Time and count each call on its own; the counters
+    // run only around the body, not the preparation
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        if (prepare)
+            prepare(i);
+        if (counters != NULL)
+            counters->start();
+        Clock::time_point start = Clock::now();
+        body(i);
+        Clock::time_point stop = Clock::now();
+        if (counters != NULL)
+            counters->stop();
+        samples.push_back(chrono::duration<double, nano>(stop - start).count());
+    }
+
+    BenchResult result;
+    if (counters != NULL)
+        result.perf = counters->read();
+    result.name = name;
+    result.iterations = samples.size();
+    result.nsPerOp = result.opsPerSec = result.p50 = result.p99 = 0.0;
+    if (samples.empty())
+        return result;
+
+    double total = 0.0;
+    // Loop goal: Sum the samples for the mean
+    for (double sample : samples)
+    {
+        total += sample;
+    }
+    sort(samples.begin(), samples.end());
+    result.nsPerOp = total / samples.size();
+    result.opsPerSec = result.nsPerOp > 0.0 ? 1e9 / result.nsPerOp : 0.0;
+    result.p50 = samples[samples.size() / 2];
+    result.p99 = samples[min(samples.size() - 1, samples.size() * 99 / 100)];
+    return result;
+}
+
+//--------------------------------------------------
+// Function: measure
+//--------------------------------------------------
+// measure() without an untimed preparation step.
+static BenchResult measure(const string &name, size_t iterations,
+                           const function<void(size_t)> &body)
+{
+    return measure(name, iterations, function<void(size_t)>(), body);
+}
+
+//--------------------------------------------------
+// Function: printHeader
+//--------------------------------------------------
+// Prints the heading of the results table, with the counter
+// columns when counters are open.
+static void printHeader()
+{
+    cout << "  " << left << setw(50) << "OPERATION" << right << setw(7) << "ITERS"
+         << setw(14) << "NS/OP" << setw(13) << "OPS/S" << setw(13) << "P50 NS"
+         << setw(13) << "P99 NS";
+    if (counters != NULL)
+    {
+        cout << setw(13) << "CYC/OP" << setw(13) << "INS/OP" << setw(7) << "IPC"
+             << setw(13) << "CMISS/OP" << setw(13) << "BMISS/OP";
+    }
+    cout << "\n";
+}
+
+//--------------------------------------------------
+// Function: printPerOp
+//--------------------------------------------------
+// Prints one counter divided by the number of calls, or "-" if
+// the counter is unavailable.
+static void printPerOp(const BenchResult &r, PerfCounter counter)
+{
+    if (!r.perf.available[counter] || r.iterations == 0)
+        cout << setw(13) << "-";
+    else
+        cout << setw(13) << setprecision(counter == PERF_CACHE_MISSES || counter == PERF_BRANCH_MISSES ? 1 : 0)
+             << static_cast<double>(r.perf.value[counter]) / r.iterations;
+}
+
+//--------------------------------------------------
+// Function: printResult
+//--------------------------------------------------
+// Prints one line of the results table.
+static void printResult(const BenchResult &r)
+{
+    cout << "  " << left << setw(50) << r.name << right
+         << setw(7) << r.iterations
+         << setw(14) << fixed << setprecision(0) << r.nsPerOp
+         << setw(13) << r.opsPerSec
+         << setw(13) << r.p50
+         << setw(13) << r.p99;
+    if (counters != NULL)
+    {
+        printPerOp(r, PERF_CYCLES);
+        printPerOp(r, PERF_INSTRUCTIONS);
+        if (r.perf.ipc() > 0.0)
+            cout << setw(7) << setprecision(2) << r.perf.ipc();
+        else
+            cout << setw(7) << "-";
+        printPerOp(r, PERF_CACHE_MISSES);
+        printPerOp(r, PERF_BRANCH_MISSES);
+    }
+    cout << "\n";
+}
+
+//--------------------------------------------------
+// Function: sailingID
+//--------------------------------------------------
+// Builds the i-th sailing ID (TTT-DD-HH): hours vary fastest,
+// then days, then terminals (AAA, AAB, ...).
+static string sailingID(size_t i)
+{
+    size_t hour = i % 24;
+    size_t day = 1 + (i / 24) % 31;
+    size_t terminal = i / (24 * 31);
+    char id[16];
+    snprintf(id, sizeof(id), "%c%c%c-%02u-%02u",
+             static_cast<char>('A' + terminal / (26 * 26) % 26),
+             static_cast<char>('A' + terminal / 26 % 26),
+             static_cast<char>('A' + terminal % 26),
+             static_cast<unsigned>(day), static_cast<unsigned>(hour));
+    return id;
+}
+
+//--------------------------------------------------
+// Function: plate
+//--------------------------------------------------
+// Builds the i-th license plate with the given leading letters.
+static string plate(const char *lead, size_t i)
+{
+    char text[16];
+    snprintf(text, sizeof(text), "%s%07u", lead, static_cast<unsigned>(i % 10000000));
+    return text;
+}
+
+//--------------------------------------------------
+// Function: phone
+//--------------------------------------------------
+// Phone of vehicle i; each number is shared by two vehicles.
+static string phone(size_t i)
+{
+    char text[16];
+    snprintf(text, sizeof(text), "604%07u", static_cast<unsigned>(i / 2 % 10000000));
+    return text;
+}
+
+//--------------------------------------------------
+// Function: makeSailing
+//--------------------------------------------------
+// Builds a roomy sailing holding 'reserved' bookings.
+static Sailing makeSailing(const string &id, size_t reserved)
+{
+    ostringstream line;
+    line << id << "|Bench Vessel|100000|100000|100000|100000|" << reserved << "|0|0|0";
+    Sailing sailing;
+    sailing.createSailing(line.str());
+    return sailing;
+}
+
+//--------------------------------------------------
+// Function: makeReservation
+//--------------------------------------------------
+// Builds a reservation record.
+static ReservationRecord makeReservation(const string &licensePlate, const string &sid)
+{
+    ReservationRecord record;
+    memset(&record, 0, sizeof(record));
+    strncpy(record.licensePlate, licensePlate.c_str(), LICENSE_PLATE_MAX - 1);
+    strncpy(record.sailingID, sid.c_str(), SAILING_ID_MAX - 1);
+    record.onboard = false;
+    return record;
+}
+
+//--------------------------------------------------
+// Function: populate
+//--------------------------------------------------
+// Writes n sailings, n vehicles and n reservations through the
+// batch calls (saveSailing() per sailing). The vehicles replace
+// the previous size's file through bulkLoad(), so its phone
+// index and plate trie are rebuilt rather than carried over.
+// Reservation i books
+// vehicle i on sailing i / BOOKINGS_PER_SAILING, so the first
+// tenth of the sailings are booked and the rest are empty.
+static void populate(size_t n)
+{
+    remove("sailingData.dat");
+    remove(RESERVATION_FILE);
+
+    sailingFileIO::openFile();
+    // Loop goal: Save each sailing with its booking count
+    for (size_t i = 0; i < n; ++i)
+    {
+        size_t booked = n / BOOKINGS_PER_SAILING;
+        size_t reserved = i < booked ? BOOKINGS_PER_SAILING : (i == booked ? n % BOOKINGS_PER_SAILING : 0);
+        sailingFileIO::saveSailing(makeSailing(sailingID(i), reserved));
+    }
+
+    vector<Vehicle> vehicles(n);
+    // Loop goal: Build every vehicle; every fifth is special
+    for (size_t i = 0; i < n; ++i)
+    {
+        bool special = i % 5 == 0;
+        vehicles[i].initialize(plate("BV", i).c_str(), phone(i).c_str(),
+                               special ? 9.0f : 7.0f, special ? 3.0f : 2.0f);
+    }
+    FileIOforVehicle vehicleIO;
+    vehicleIO.bulkLoad(vehicles);
+
+    vector<ReservationRecord> records(n);
+    // Loop goal: Book each vehicle on its sailing
+    for (size_t i = 0; i < n; ++i)
+    {
+        records[i] = makeReservation(plate("BV", i), sailingID(i / BOOKINGS_PER_SAILING));
+    }
+    open(RESERVATION_FILE);
+    saveReservations(records);
+}
+
+//--------------------------------------------------
+// Function: runSize
+//--------------------------------------------------
+// Fills the stores with n records each and times every
+// operation against them.
+static void runSize(size_t n)
+{
+    chrono::steady_clock::time_point started = chrono::steady_clock::now();
+    populate(n);
+    double setupSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+    size_t points = min(n, POINT_ITERATIONS);
+    size_t scans = max(MIN_SCAN_ITERATIONS, min(POINT_ITERATIONS, SCAN_BUDGET / n));
+    size_t batches = max<size_t>(1, min(points, n / BATCH_SIZE));
+    size_t booked = max<size_t>(1, n / BOOKINGS_PER_SAILING);
+    mt19937 random(12345);
+    vector<size_t> picks(POINT_ITERATIONS);
+    // Loop goal: Draw the record indexes the point lookups use
+    for (size_t i = 0; i < picks.size(); ++i)
+    {
+        picks[i] = random() % n;
+    }
+
+    cout << "\nN = " << n << " records per store (setup " << fixed << setprecision(1)
+         << setupSeconds << " s)\n";
+    printHeader();
+
+    // ---- sailingFileIO ----
+    // Each open/close pair starts closed: opening an open stream fails
+    sailingFileIO::closeFile();
+    printResult(measure("sailingFileIO::closeFile", scans,
+        [](size_t) { sailingFileIO::openFile(); },
+        [](size_t) { sailingFileIO::closeFile(); }));
+    printResult(measure("sailingFileIO::openFile", scans,
+        [](size_t) { sailingFileIO::closeFile(); },
+        [](size_t) { sailingFileIO::openFile(); }));
+    printResult(measure("sailingFileIO::exists", points, [&](size_t i)
+    {
+        sailingFileIO::exists(sailingID(picks[i]).c_str());
+    }));
+    printResult(measure("sailingFileIO::getSailing", points, [&](size_t i)
+    {
+        sailingFileIO::getSailing(sailingID(picks[i]).c_str());
+    }));
+    printResult(measure("sailingFileIO::reportRows", points, [](size_t)
+    {
+        sailingFileIO::reportRows();
+    }));
+    printResult(measure("sailingFileIO::query (terminal, top 5 full)", points, [&](size_t i)
+    {
+        SailingQuery query;
+        query.terminal = sailingID(picks[i]).substr(0, 3);
+        query.order = ORDER_PERCENT_FULL;
+        query.limit = 5;
+        sailingFileIO::query(query);
+    }));
+    printResult(measure("sailingFileIO::saveSailing (update)", points, [&](size_t i)
+    {
+        sailingFileIO::saveSailing(sailingFileIO::getSailing(sailingID(picks[i]).c_str()));
+    }));
+    printResult(measure("sailingFileIO::saveSailing (append)", scans, [&](size_t i)
+    {
+        sailingFileIO::saveSailing(makeSailing(sailingID(n + i), 0));
+    }));
+    printResult(measure("sailingFileIO::deleteSailing", scans, [&](size_t i)
+    {
+        sailingFileIO::deleteSailing(sailingID(n + i).c_str());
+    }));
+
+    // ---- FileIOforVehicle ----
+    FileIOforVehicle vehicleIO;
+    printResult(measure("FileIOforVehicle::close", points,
+        [&](size_t) { vehicleIO.open(); },
+        [&](size_t) { vehicleIO.close(); }));
+    printResult(measure("FileIOforVehicle::open", points,
+        [&](size_t) { vehicleIO.close(); },
+        [&](size_t) { vehicleIO.open(); }));
+    printResult(measure("FileIOforVehicle::exists", scans, [&](size_t i)
+    {
+        vehicleIO.exists(plate("BV", picks[i]));
+    }));
+    printResult(measure("FileIOforVehicle::getAllVehicles", scans, [&](size_t)
+    {
+        vehicleIO.getAllVehicles();
+    }));
+    printResult(measure("FileIOforVehicle::getVehicle", scans, [&](size_t i)
+    {
+        vehicleIO.getVehicle(plate("BV", picks[i]));
+    }));
+    printResult(measure("FileIOforVehicle::getVehicleWithData", scans, [&](size_t i)
+    {
+        Vehicle vehicle;
+        string phoneOut;
+        vehicleIO.getVehicleWithData(plate("BV", picks[i]), vehicle, phoneOut);
+    }));
+    printResult(measure("FileIOforVehicle::getVehicles (10 plates)", scans, [&](size_t i)
+    {
+        vector<string> plates;
+        // Loop goal: Ask for ten plates spread over the file
+        for (size_t k = 0; k < 10; ++k)
+        {
+            plates.push_back(plate("BV", (picks[i] + k * n / 10) % n));
+        }
+        vehicleIO.getVehicles(plates);
+    }));
+    printResult(measure("FileIOforVehicle::getManifest", scans, [&](size_t i)
+    {
+        vehicleIO.getManifest(sailingID(picks[i] % booked));
+    }));
+    printResult(measure("FileIOforVehicle::saveVehicle", scans, [&](size_t i)
+    {
+        Vehicle vehicle;
+        vehicle.initialize("UNKNOWN", phone(i).c_str(), 7.0f, 2.0f);
+        vehicleIO.saveVehicle(vehicle);
+    }));
+    vehicleIO.deleteVehicle("UNKNOWN");
+    printResult(measure("FileIOforVehicle::saveVehicleWithData (update)", scans, [&](size_t i)
+    {
+        Vehicle vehicle;
+        vehicle.initialize(plate("BV", picks[i]).c_str(), phone(picks[i]).c_str(), 7.0f, 2.0f);
+        vehicleIO.saveVehicleWithData(vehicle, plate("BV", picks[i]), phone(picks[i]));
+    }));
+    printResult(measure("FileIOforVehicle::saveVehicleWithData (append)", scans, [&](size_t i)
+    {
+        Vehicle vehicle;
+        vehicle.initialize(plate("NV", i).c_str(), phone(i).c_str(), 7.0f, 2.0f);
+        vehicleIO.saveVehicleWithData(vehicle, plate("NV", i), phone(i));
+    }));
+    printResult(measure("FileIOforVehicle::deleteVehicle", scans, [&](size_t i)
+    {
+        vehicleIO.deleteVehicle(plate("NV", i));
+    }));
+    vector<Vehicle> batch;
+    printResult(measure("FileIOforVehicle::saveVehicles (100 updates)", scans,
+        [&](size_t i)
+        {
+            batch.assign(min(n, BATCH_SIZE), Vehicle());
+            // Loop goal: Rewrite a run of existing vehicles unchanged
+            for (size_t k = 0; k < batch.size(); ++k)
+            {
+                size_t index = (picks[i] + k) % n;
+                bool special = index % 5 == 0;
+                batch[k].initialize(plate("BV", index).c_str(), phone(index).c_str(),
+                                    special ? 9.0f : 7.0f, special ? 3.0f : 2.0f);
+            }
+        },
+        [&](size_t)
+        {
+            vehicleIO.saveVehicles(batch);
+        }));
+    printResult(measure("FileIOforVehicle::getPlatesForPhone", points, [&](size_t i)
+    {
+        vehicleIO.getPlatesForPhone(phone(picks[i]));
+    }));
+    printResult(measure("FileIOforVehicle::getUpcomingForPhone", points, [&](size_t i)
+    {
+        vehicleIO.getUpcomingForPhone(phone(picks[i]));
+    }));
+    printResult(measure("FileIOforVehicle::findPlatesWithPrefix", points, [&](size_t i)
+    {
+        vehicleIO.findPlatesWithPrefix(plate("BV", picks[i]).substr(0, 6), 20);
+    }));
+    printResult(measure("FileIOforVehicle::findSimilarPlates (d=1)", points, [&](size_t i)
+    {
+        string typo = plate("BV", picks[i]);
+        typo[typo.size() - 1] = 'X';
+        vehicleIO.findSimilarPlates(typo, 1, 20);
+    }));
+    vehicleIO.close();
+
+    // ---- reservationFileIO ----
+    close();
+    printResult(measure("reservationFileIO::close", scans,
+        [](size_t) { open(RESERVATION_FILE); },
+        [](size_t) { close(); }));
+    printResult(measure("reservationFileIO::open", scans,
+        [](size_t) { close(); },
+        [](size_t) { open(RESERVATION_FILE); }));
+    printResult(measure("reservationFileIO::getReservation", points, [&](size_t i)
+    {
+        ReservationRecord record;
+        getReservation(plate("BV", picks[i]), sailingID(picks[i] / BOOKINGS_PER_SAILING), record);
+    }));
+    printResult(measure("reservationFileIO::exists", points, [&](size_t i)
+    {
+        exists(plate("BV", picks[i]), sailingID(picks[i] / BOOKINGS_PER_SAILING));
+    }));
+    printResult(measure("reservationFileIO::saveReservation (update)", points, [&](size_t i)
+    {
+        saveReservation(makeReservation(plate("BV", picks[i]), sailingID(picks[i] / BOOKINGS_PER_SAILING)));
+    }));
+    printResult(measure("reservationFileIO::saveReservation (append)", scans, [&](size_t i)
+    {
+        saveReservation(makeReservation(plate("NR", i), sailingID(n + 1)));
+    }));
+    printResult(measure("reservationFileIO::deleteReservation", scans, [&](size_t i)
+    {
+        deleteReservation(plate("NR", i), sailingID(n + 1));
+    }));
+    printResult(measure("reservationFileIO::saveReservations (100 updates)", batches, [&](size_t i)
+    {
+        vector<ReservationRecord> records;
+        // Loop goal: Rewrite a run of existing reservations unchanged
+        for (size_t k = 0; k < min(n, BATCH_SIZE); ++k)
+        {
+            size_t index = (picks[i] + k) % n;
+            records.push_back(makeReservation(plate("BV", index), sailingID(index / BOOKINGS_PER_SAILING)));
+        }
+        saveReservations(records);
+    }));
+    printResult(measure("reservationFileIO::deleteReservationsWhere", scans,
+        [&](size_t)
+        {
+            vector<ReservationRecord> records;
+            // Loop goal: Add ten reservations for the delete to remove
+            for (size_t k = 0; k < 10; ++k)
+            {
+                records.push_back(makeReservation(plate("NR", k), sailingID(n + 1)));
+            }
+            saveReservations(records);
+        },
+        [&](size_t)
+        {
+            string target = sailingID(n + 1);
+            deleteReservationsWhere([&](const ReservationRecord &record)
+            {
+                return strncmp(record.sailingID, target.c_str(), SAILING_ID_MAX) == 0;
+            });
+        }));
+    printResult(measure("reservationFileIO::getAllOnSailing", points, [&](size_t i)
+    {
+        getAllOnSailing(sailingID(picks[i] % booked));
+    }));
+    printResult(measure("reservationFileIO::getAllWithVehicle", points, [&](size_t i)
+    {
+        getAllWithVehicle(plate("BV", picks[i]));
+    }));
+    printResult(measure("reservationFileIO::moveAllOnSailing", points, [&](size_t i)
+    {
+        // Move a booked sailing to an empty one and back on the next call
+        string from = sailingID(picks[i / 2 * 2] % booked);
+        string to = sailingID(n + 2);
+        if (i % 2 == 0)
+            moveAllOnSailing(from, to);
+        else
+            moveAllOnSailing(to, from);
+    }));
+    printResult(measure("reservationFileIO::getAllReservations", scans, [](size_t)
+    {
+        getAllReservations();
+    }));
+
+    // ---- revenueReport ----
+    vector<float> specialColumn(n), lengthColumn(n), heightColumn(n);
+    vector<int32_t> centsColumn(n);
+    // Loop goal: Fill the fare columns; every fifth vehicle is special
+    for (size_t i = 0; i < n; ++i)
+    {
+        bool special = i % 5 == 0;
+        specialColumn[i] = special ? 1.0f : 0.0f;
+        lengthColumn[i] = special ? 9.0f + (i % 7) : 7.0f;
+        heightColumn[i] = special ? 3.0f : 2.0f;
+    }
+    string kernel = fareKernelUsesAVX2() ? "avx2" : "scalar";
+    printResult(measure("computeFareCents (" + kernel + ", " + to_string(n) + " vehicles)", scans,
+        [&](size_t)
+        {
+            computeFareCents(specialColumn.data(), lengthColumn.data(), heightColumn.data(),
+                             centsColumn.data(), n);
+        }));
+    printResult(measure("buildRevenueReport", scans, [](size_t)
+    {
+        buildRevenueReport();
+    }));
+
+    // ---- reservation ----
+    string roomy = sailingID(n + 3);
+    string spare = sailingID(n + 4);
+    sailingFileIO::saveSailing(makeSailing(roomy, 0));
+    sailingFileIO::saveSailing(makeSailing(spare, 0));
+    printResult(measure("addReservation", points, [&](size_t i)
+    {
+        addReservation(roomy, plate("AR", i), phone(i), false, 0.0f, 0.0f);
+    }));
+    printResult(measure("checkIn", points, [&](size_t i)
+    {
+        checkIn(roomy, plate("AR", i), false, 0.0f, 0.0f);
+    }));
+    printResult(measure("moveReservations (" + to_string(points) + " vehicles)", scans, [&](size_t i)
+    {
+        if (i % 2 == 0)
+            moveReservations(roomy, spare);
+        else
+            moveReservations(spare, roomy);
+    }));
+
+    close();
+    sailingFileIO::closeFile();
+}
+
+//--------------------------------------------------
+// Main benchmark driver. Arguments are store sizes.
+int main(int argc, char *argv[])
+{
+    vector<size_t> sizes;
+    // Loop goal: Read each requested size
+    for (int i = 1; i < argc; ++i)
+    {
+        long size = strtol(argv[i], NULL, 10);
+        if (size > 0)
+            sizes.push_back(static_cast<size_t>(size));
+    }
+    if (sizes.empty())
+        sizes = {1000, 100000, 1000000};
+
+    mkdir(BENCH_DIR, 0755);
+    if (chdir(BENCH_DIR) != 0)
+    {
+        cerr << "Cannot enter " << BENCH_DIR << "\n";
+        return 1;
+    }
+
+    cout << "Ferry Reservation System benchmark\n";
+    PerfCounters perf;
+    if (perf.available())
+    {
+        counters = &perf;
+        cout << "Hardware counters: user-space cycles, instructions, cache misses and\n"
+             << "branch misses of the benchmark thread, per call (thread pool workers\n"
+             << "are not counted).\n";
+    }
+    else
+        cout << "Hardware counters unavailable (" << perf.unavailableReason()
+             << "); reporting times only.\n";
+    // Loop goal: Run the whole suite at each size
+    for (size_t n : sizes)
+    {
+        runSize(n);
+    }
+    return 0;
+}
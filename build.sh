@@ -5,9 +5,22 @@
 
 echo "Building Ferry Reservation System..."
 
+# Compile the core library
+echo "Compiling core library..."
+g++ -fdiagnostics-color=always -g -pthread -c sailing.cpp sailingFileIO.cpp vehicle.cpp vehicleFileIO.cpp reservation.cpp reservationFileIO.cpp recordIO.cpp threadPool.cpp revenueReport.cpp plateTrie.cpp workloadGenerator.cpp operationTrace.cpp latencyStats.cpp spanTrace.cpp ioStats.cpp perfCounters.cpp storeAudit.cpp && \
+    rm -f libfrss.a && \
+    ar rcs libfrss.a sailing.o sailingFileIO.o vehicle.o vehicleFileIO.o reservation.o reservationFileIO.o recordIO.o threadPool.o revenueReport.o plateTrie.o workloadGenerator.o operationTrace.o latencyStats.o spanTrace.o ioStats.o perfCounters.o storeAudit.o
+
+if [ $? -eq 0 ]; then
+    echo "✓ Core library archived successfully -> libfrss.a"
+else
+    echo "✗ Core library compilation failed"
+    exit 1
+fi
+
 # Compile main ferry system
 echo "Compiling main system..."
-g++ -fdiagnostics-color=always -g main.cpp ui.cpp sailing.cpp sailingFileIO.cpp vehicle.cpp vehicleFileIO.cpp reservation.cpp reservationFileIO.cpp -o ferry_system
+g++ -fdiagnostics-color=always -g -pthread main.cpp ui.cpp sailingMenu.cpp vehicleMenu.cpp batchCommands.cpp libfrss.a -o ferry_system
 
 if [ $? -eq 0 ]; then
     echo "✓ Main system compiled successfully -> ferry_system"
@@ -18,7 +31,7 @@ fi
 
 # Compile unit test
 echo "Compiling unit test..."
-g++ -fdiagnostics-color=always -g unitTest.cpp reservationFileIO.cpp -o unit_test
+g++ -fdiagnostics-color=always -g -pthread unitTest.cpp libfrss.a -o unit_test
 
 if [ $? -eq 0 ]; then
     echo "✓ Unit test compiled successfully -> unit_test"
@@ -27,11 +40,25 @@ else
     exit 1
 fi
 
+# Compile storage I/O budget test
+echo "Compiling I/O budget test..."
+g++ -fdiagnostics-color=always -g -pthread ioBudgetTest.cpp libfrss.a -o io_budget_test
+
+if [ $? -eq 0 ]; then
+    echo "✓ I/O budget test compiled successfully -> io_budget_test"
+else
+    echo "✗ I/O budget test compilation failed"
+    exit 1
+fi
+
 echo ""
 echo "Build complete! Executables created:"
+echo "  - libfrss.a (core library linked by every executable)"
 echo "  - ferry_system (main application)"
 echo "  - unit_test (reservation file I/O unit test)"
+echo "  - io_budget_test (storage I/O budgets per operation)"
 echo ""
 echo "To run:"
 echo "  ./ferry_system    # Start the ferry reservation system"
 echo "  ./unit_test       # Run the unit tests"
+echo "  ./io_budget_test  # Check the storage I/O budgets"
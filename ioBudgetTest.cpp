@@ -0,0 +1,328 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Storage I/O budget test. Generates a dataset at each of a
+//   growing list of sizes and calls the core operations against
+//   it, checking what each call did at the storage layer (the
+//   ioStats.h counters) against a fixed budget.
+//
+//   Point operations (lookups, check-in, booking) get budgets
+//   that do not depend on the size of the files: a few records
+//   read, no full scans and no reopens (check-in alone opens the
+//   vehicle file once to price the vehicle). An operation that goes
+//   back to reading or rewriting whole files passes at the
+//   smallest size and fails at the larger ones.
+//
+//   Operations that have to pass over a file (cancelling, which
+//   rewrites the reservation file, and lane check-in, which
+//   loads vehicle dimensions in one pass) are held to a fixed
+//   number of passes, so an extra rescan or reopen fails.
+//
+//   A call that fails is reported as a failure whatever its
+//   counters show.
+//************************************************************
+// USAGE:
+// - make budget                          (sizes from IO_BUDGET_SIZES)
+// - ./io_budget_test 1000 10000 100000   (choose the sizes)
+// - Data files are written under budget_data/, never over the
+//   real ones. Prints PASS/FAIL per operation and size, and
+//   exits with status 1 if any budget was exceeded.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial I/O budgets for the core operations.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Each call must succeed before its counters are
+//            checked, so a call that fails early cannot pass its
+//            budget by doing no I/O.
+//          - checkIn() may open the vehicle file once, to price the
+//            vehicle from its registered record.
+//************************************************************
+
+#include "sailing.h"
+#include "sailingFileIO.h"
+#include "vehicle.h"
+#include "vehicleFileIO.h"
+#include "reservation.h"
+#include "reservationFileIO.h"
+#include "workloadGenerator.h"
+#include "ioStats.h"
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+//--------------------------------------------------
+// Scratch directory the test runs in
+const char *BUDGET_DIR = "budget_data";
+
+// Sizes used when none are given
+const size_t DEFAULT_SIZES[] = {1000, 10000, 100000};
+
+// Records a point operation may read: the record it looks up
+// and, at most, the one it then rewrites
+const uint64_t POINT_RECORDS = 2;
+
+//--------------------------------------------------
+// Most one counter may grow by during one call
+struct Budget
+{
+    IOCounter counter; // Counter limited
+    uint64_t limit;    // Largest allowed increase
+};
+
+// Number of budgets exceeded so far
+static int failures = 0;
+
+//--------------------------------------------------
+// Function: checkBudget
+//--------------------------------------------------
+// Compares the work one call did with its budget and prints one
+// PASS or FAIL line, naming each counter that went over. A call
+// that did not succeed fails without its counters being checked.
+static void checkBudget(size_t n, const std::string &operation, bool succeeded,
+                        const IOCounts &used, const std::vector<Budget> &budget)
+{
+    if (!succeeded)
+    {
+        std::cout << "FAIL: N=" << n << " " << operation << " - call failed\n";
+        ++failures;
+        return;
+    }
+    std::string over;
+    // Loop goal: Collect each counter that exceeded its limit
+    for (const Budget &b : budget)
+    {
+        if (used[b.counter] > b.limit)
+        {
+            over += " " + std::string(ioCounterName(b.counter)) + " " +
+                    std::to_string(used[b.counter]) + " > " + std::to_string(b.limit);
+        }
+    }
+    std::cout << (over.empty() ? "PASS" : "FAIL") << ": N=" << n << " " << operation;
+    if (!over.empty())
+    {
+        std::cout << " -" << over;
+        ++failures;
+    }
+    std::cout << "\n";
+}
+
+//--------------------------------------------------
+// Function: pointBudget
+//--------------------------------------------------
+// Budget of an operation that touches a fixed number of records:
+// at most 'records' read, 'flushes' flushes and 'reopens' file
+// opens, and no full scans.
+static std::vector<Budget> pointBudget(uint64_t records, uint64_t flushes, uint64_t reopens = 0)
+{
+    std::vector<Budget> budget;
+    budget.push_back({IO_RECORDS_READ, records});
+    budget.push_back({IO_FLUSHES, flushes});
+    budget.push_back({IO_FULL_SCANS, 0});
+    budget.push_back({IO_REOPENS, reopens});
+    return budget;
+}
+
+//--------------------------------------------------
+// Function: passBudget
+//--------------------------------------------------
+// Budget of an operation that has to pass over whole files: at
+// most 'scans' full scans, 'reopens' reopens and 'flushes'
+// flushes, however large the files are.
+static std::vector<Budget> passBudget(uint64_t scans, uint64_t reopens, uint64_t flushes)
+{
+    std::vector<Budget> budget;
+    budget.push_back({IO_FULL_SCANS, scans});
+    budget.push_back({IO_REOPENS, reopens});
+    budget.push_back({IO_FLUSHES, flushes});
+    return budget;
+}
+
+//--------------------------------------------------
+// Function: generate
+//--------------------------------------------------
+// Replaces the data files with n vehicles and n bookings spread
+// over n / 10 sailings. Returns false if generation fails.
+static bool generate(size_t n)
+{
+    WorkloadConfig config;
+    config.seed = 49;
+    config.sailings = n / 10 > 50 ? n / 10 : 50;
+    config.vehicles = n;
+    config.reservations = n;
+    WorkloadSummary summary;
+    return generateWorkload(config, summary);
+}
+
+//--------------------------------------------------
+// Function: runSize
+//--------------------------------------------------
+// Generates the dataset for size n, opens the stores, and checks
+// each operation against its budget.
+static void runSize(size_t n)
+{
+    if (!generate(n))
+    {
+        std::cout << "FAIL: N=" << n << " could not generate the dataset\n";
+        ++failures;
+        return;
+    }
+    Sailing::initialize();
+    initialize();
+    FileIOforVehicle vehicles;
+    vehicles.open();
+
+    // Pick the targets before measuring: a sailing with four
+    // bookings not yet checked in, and a sailing with room
+    std::map<std::string, std::vector<std::string> > waiting;
+    std::string busySailing;
+    // Loop goal: Group the bookings not yet checked in by sailing
+    // until one sailing has four
+    for (const ReservationRecord &r : getAllReservations())
+    {
+        if (r.onboard)
+            continue;
+        std::vector<std::string> &plates = waiting[r.sailingID];
+        plates.push_back(r.licensePlate);
+        if (plates.size() == 4)
+        {
+            busySailing = r.sailingID;
+            break;
+        }
+    }
+    std::string openSailing;
+    // Loop goal: Find a sailing with room for a few regular vehicles
+    for (const SailingReportRow &row : sailingFileIO::reportRows())
+    {
+        if (row.sailing.getLRL() >= 50.0f && row.sailing.getHRL() >= 50.0f)
+        {
+            openSailing = row.sailing.getSailingID();
+            break;
+        }
+    }
+    if (busySailing.empty() || openSailing.empty())
+    {
+        std::cout << "FAIL: N=" << n << " dataset has no sailing to test with\n";
+        ++failures;
+        vehicles.close();
+        shutdown();
+        Sailing::shutdown();
+        return;
+    }
+    const std::vector<std::string> &plates = waiting[busySailing];
+    ReservationRecord record;
+    Vehicle vehicle;
+    std::string phone;
+    IOCounts before;
+
+    // ---- stores ----
+    before = ioTotals();
+    Sailing found = sailingFileIO::getSailing(busySailing.c_str());
+    checkBudget(n, "sailingFileIO::getSailing", busySailing == found.getSailingID(),
+                ioTotals() - before, pointBudget(1, 0));
+
+    before = ioTotals();
+    bool sailingSaved = sailingFileIO::saveSailing(sailingFileIO::getSailing(busySailing.c_str()));
+    checkBudget(n, "sailingFileIO::saveSailing (update)", sailingSaved, ioTotals() - before,
+                pointBudget(POINT_RECORDS, 1));
+
+    before = ioTotals();
+    bool reservationFound = getReservation(plates[0], busySailing, record);
+    checkBudget(n, "reservationFileIO::getReservation", reservationFound, ioTotals() - before,
+                pointBudget(1, 0));
+
+    before = ioTotals();
+    bool vehicleFound = vehicles.getVehicleWithData(plates[0], vehicle, phone);
+    checkBudget(n, "FileIOforVehicle::getVehicleWithData", vehicleFound, ioTotals() - before,
+                pointBudget(1, 0));
+
+    before = ioTotals();
+    bool vehicleSaved = vehicles.saveVehicleWithData(vehicle, plates[0], phone);
+    checkBudget(n, "FileIOforVehicle::saveVehicleWithData (update)", vehicleSaved, ioTotals() - before,
+                pointBudget(POINT_RECORDS, 1));
+
+    // ---- reservation operations ----
+    // A check-in saves the booking and the sailing's counters: one
+    // flush for each of the two files it writes. It opens the
+    // vehicle file once to read the vehicle's record for the fare.
+    before = ioTotals();
+    float fare = checkIn(busySailing, plates[0], false, 0.0f, 0.0f);
+    checkBudget(n, "reservation::checkIn", fare >= 0.0f, ioTotals() - before,
+                pointBudget(POINT_RECORDS, 2, 1));
+
+    before = ioTotals();
+    bool booked = addReservation(openSailing, "BGT0001", "6045550100", false, 0.0f, 0.0f);
+    checkBudget(n, "reservation::addReservation", booked, ioTotals() - before,
+                pointBudget(POINT_RECORDS, 2));
+
+    std::vector<GroupVehicle> group;
+    group.push_back({"BGT0002", false, 0.0f, 0.0f});
+    group.push_back({"BGT0003", false, 0.0f, 0.0f});
+    group.push_back({"BGT0004", false, 0.0f, 0.0f});
+    before = ioTotals();
+    bool groupBooked = addGroupReservation(openSailing, group);
+    checkBudget(n, "reservation::addGroupReservation (3 vehicles)", groupBooked, ioTotals() - before,
+                pointBudget(POINT_RECORDS, 2));
+
+    // Opens the vehicle file for one pass over it for the dimensions
+    std::vector<std::string> lane(plates.begin() + 1, plates.begin() + 3);
+    before = ioTotals();
+    std::vector<CheckInResult> laneResults = checkInBatch(busySailing, lane);
+    IOCounts laneIO = ioTotals() - before;
+    bool laneCheckedIn = laneResults.size() == lane.size();
+    // Loop goal: Require a fare and no error for each plate in the lane
+    for (const CheckInResult &result : laneResults)
+    {
+        laneCheckedIn = laneCheckedIn && result.error.empty() && result.fare >= 0.0f;
+    }
+    checkBudget(n, "reservation::checkInBatch (2 vehicles)", laneCheckedIn, laneIO, passBudget(1, 1, 2));
+
+    // One pass over the vehicle file for the dimensions and one
+    // rewrite of the reservation file, each opening its file once
+    before = ioTotals();
+    bool cancelled = cancelReservation(busySailing, plates[3]);
+    checkBudget(n, "reservation::cancelReservation", cancelled, ioTotals() - before, passBudget(2, 2, 2));
+
+    vehicles.close();
+    shutdown();
+    Sailing::shutdown();
+}
+
+//--------------------------------------------------
+// Main test driver
+int main(int argc, char *argv[])
+{
+    std::vector<size_t> sizes;
+    // Loop goal: Read each requested size
+    for (int i = 1; i < argc; ++i)
+    {
+        long size = std::strtol(argv[i], NULL, 10);
+        if (size > 0)
+            sizes.push_back(static_cast<size_t>(size));
+    }
+    if (sizes.empty())
+        sizes.assign(DEFAULT_SIZES, DEFAULT_SIZES + sizeof(DEFAULT_SIZES) / sizeof(DEFAULT_SIZES[0]));
+
+    mkdir(BUDGET_DIR, 0755);
+    if (chdir(BUDGET_DIR) != 0)
+    {
+        std::cout << "Cannot enter " << BUDGET_DIR << "\n";
+        return 1;
+    }
+
+    std::cout << "Running storage I/O budget test\n";
+    // Loop goal: Check every budget at each size
+    for (size_t n : sizes)
+    {
+        runSize(n);
+    }
+
+    std::cout << (failures == 0 ? "All I/O budgets met.\n" : "I/O budgets exceeded.\n");
+    return failures == 0 ? 0 : 1;
+}
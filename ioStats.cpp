@@ -0,0 +1,187 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the storage I/O counters declared in ioStats.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial storage I/O counters.
+//************************************************************
+
+#include "ioStats.h"
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+
+//--------------------------------------------------
+// Every registered operation by name. Counters are never freed.
+static std::mutex registryLock;
+static std::map<std::string, IOStat *> &registry()
+{
+    static std::map<std::string, IOStat *> stats;
+    return stats;
+}
+
+//--------------------------------------------------
+// The operation charged for work on this thread, if any.
+static thread_local IOStat *currentOperation = NULL;
+
+const char *ioCounterName(IOCounter counter)
+{
+    static const char *const NAMES[IO_COUNTER_COUNT] = {
+        "records-read", "bytes-read", "bytes-written", "seeks", "flushes", "reopens", "full-scans"};
+    return NAMES[counter];
+}
+
+IOCounts::IOCounts()
+{
+    // Loop goal: Start every count at zero
+    for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+        value[i] = 0;
+}
+
+IOCounts IOCounts::operator-(const IOCounts &before) const
+{
+    IOCounts delta;
+    // Loop goal: Subtract each counter
+    for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+        delta.value[i] = value[i] - before.value[i];
+    return delta;
+}
+
+IOStat::IOStat(const std::string &name)
+    : statName(name)
+{
+    // Loop goal: Start every counter at zero
+    for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+        counts[i].store(0, std::memory_order_relaxed);
+}
+
+IOCounts IOStat::snapshot() const
+{
+    IOCounts s;
+    // Loop goal: Copy each counter
+    for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+        s.value[i] = counts[i].load(std::memory_order_relaxed);
+    return s;
+}
+
+void IOStat::reset()
+{
+    // Loop goal: Zero each counter
+    for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+        counts[i].store(0, std::memory_order_relaxed);
+}
+
+IOStat &ioStat(const char *name)
+{
+    std::lock_guard<std::mutex> hold(registryLock);
+    IOStat *&stat = registry()[name];
+    if (stat == NULL)
+        stat = new IOStat(name);
+    return *stat;
+}
+
+void countIO(IOCounter counter, uint64_t amount)
+{
+    static IOStat &unattributed = ioStat("(unattributed)");
+    IOStat *operation = currentOperation;
+    (operation != NULL ? *operation : unattributed).add(counter, amount);
+}
+
+IOCounts ioTotals()
+{
+    IOCounts total;
+    std::lock_guard<std::mutex> hold(registryLock);
+    // Loop goal: Add up every operation's counts
+    for (const auto &entry : registry())
+    {
+        IOCounts s = entry.second->snapshot();
+        // Loop goal: Add each counter to the total
+        for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+            total.value[i] += s.value[i];
+    }
+    return total;
+}
+
+IOCounts ioCountsFor(const std::string &name)
+{
+    std::lock_guard<std::mutex> hold(registryLock);
+    std::map<std::string, IOStat *>::const_iterator found = registry().find(name);
+    return found != registry().end() ? found->second->snapshot() : IOCounts();
+}
+
+std::vector<std::pair<std::string, IOCounts> > ioSnapshots()
+{
+    std::vector<std::pair<std::string, IOCounts> > snapshots;
+    std::lock_guard<std::mutex> hold(registryLock);
+    // Loop goal: Copy every operation that was charged with work, in name order
+    for (const auto &entry : registry())
+    {
+        IOCounts s = entry.second->snapshot();
+        bool any = false;
+        // Loop goal: Check whether any counter is non-zero
+        for (size_t i = 0; i < IO_COUNTER_COUNT && !any; ++i)
+            any = s.value[i] != 0;
+        if (any)
+            snapshots.push_back(std::make_pair(entry.first, s));
+    }
+    return snapshots;
+}
+
+void resetIOStats()
+{
+    std::lock_guard<std::mutex> hold(registryLock);
+    // Loop goal: Zero every operation's counters
+    for (const auto &entry : registry())
+        entry.second->reset();
+}
+
+//--------------------------------------------------
+// Function: writeCountsLine
+//--------------------------------------------------
+// Writes one row of the I/O table.
+static void writeCountsLine(std::ostream &out, const std::string &name, const IOCounts &counts)
+{
+    out << "  " << std::left << std::setw(40) << name << std::right;
+    // Loop goal: Write each counter in its column
+    for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+        out << std::setw(14) << counts.value[i];
+    out << "\n";
+}
+
+void writeIOStats(std::ostream &out)
+{
+    std::vector<std::pair<std::string, IOCounts> > snapshots = ioSnapshots();
+    std::ios::fmtflags flags = out.flags();
+    out << "Storage I/O by top-level operation:\n";
+    out << "  " << std::left << std::setw(40) << "operation" << std::right;
+    // Loop goal: Write each counter's heading
+    for (size_t i = 0; i < IO_COUNTER_COUNT; ++i)
+        out << std::setw(14) << ioCounterName(static_cast<IOCounter>(i));
+    out << "\n";
+    // Loop goal: Write one line per operation
+    for (const auto &entry : snapshots)
+        writeCountsLine(out, entry.first, entry.second);
+    if (snapshots.empty())
+        out << "  (no storage I/O recorded)\n";
+    else
+        writeCountsLine(out, "total", ioTotals());
+    out.flags(flags);
+}
+
+IOScope::IOScope(IOStat &stat)
+    : outermost(currentOperation == NULL)
+{
+    if (outermost)
+        currentOperation = &stat;
+}
+
+IOScope::~IOScope()
+{
+    if (outermost)
+        currentOperation = NULL;
+}
@@ -0,0 +1,179 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the storage I/O counters: records read, bytes read
+//   and written, seeks, flushes, file open cycles and full-file
+//   scans, counted where the stores touch their files and
+//   charged to the top-level operation that caused them, so the
+//   cost of rescans and reopens can be seen and tested.
+//************************************************************
+// USAGE:
+// - The stores and recordIO call countIO() next to each seek,
+//   read, write, flush, open and whole-file scan.
+// - Every LatencyTimer (latencyStats.h) opens an IOScope; the
+//   outermost one on a thread is the top-level operation that is
+//   charged, e.g. reservation::checkIn for the getReservation,
+//   saveReservation and saveSailing it calls. Work outside any
+//   operation is charged to "(unattributed)".
+// - ioCountsFor() and ioTotals() return the counts so far; take
+//   one before and one after a call and subtract them to see what
+//   the call did. writeIOStats() prints the table.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial storage I/O counters.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef IO_STATS_H
+#define IO_STATS_H
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+//--------------------------------------------------
+// Kinds of storage work counted.
+enum IOCounter
+{
+    IO_RECORDS_READ,  // fixed-length records read
+    IO_BYTES_READ,    // bytes read from store and index files
+    IO_BYTES_WRITTEN, // bytes written to store and index files
+    IO_SEEKS,         // seekg()/seekp() calls
+    IO_FLUSHES,       // flushes of a store file
+    IO_REOPENS,       // times a store or index file was (re)opened
+    IO_FULL_SCANS,    // whole-file reads
+    IO_COUNTER_COUNT
+};
+
+//--------------------------------------------------
+// Returns the short name of a counter, e.g. "seeks".
+const char *ioCounterName(
+    IOCounter counter // in: counter
+);
+
+//--------------------------------------------------
+// One set of counts.
+struct IOCounts
+{
+    uint64_t value[IO_COUNTER_COUNT];
+
+    IOCounts();
+
+    uint64_t operator[](
+        IOCounter counter // in: counter to read
+    ) const
+    {
+        return value[counter];
+    }
+
+    // Returns the work done between 'before' and these counts.
+    IOCounts operator-(
+        const IOCounts &before // in: earlier counts
+    ) const;
+};
+
+//--------------------------------------------------
+// Counters of one top-level operation.
+class IOStat
+{
+public:
+    explicit IOStat(
+        const std::string &name // in: operation name
+    );
+
+    // Adds 'amount' to one counter.
+    void add(
+        IOCounter counter, // in: counter
+        uint64_t amount    // in: amount to add
+    )
+    {
+        counts[counter].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    // Returns the counts so far.
+    IOCounts snapshot() const;
+
+    // Zeroes every counter.
+    void reset();
+
+    // Returns the operation name.
+    const std::string &name() const
+    {
+        return statName;
+    }
+
+private:
+    std::string statName;
+    std::atomic<uint64_t> counts[IO_COUNTER_COUNT];
+
+    IOStat(const IOStat &);
+    IOStat &operator=(const IOStat &);
+};
+
+//--------------------------------------------------
+// Returns the counters registered under 'name', creating them
+// on first use. They live until the program ends.
+IOStat &ioStat(
+    const char *name // in: operation name
+);
+
+//--------------------------------------------------
+// Charges storage work to the calling thread's top-level
+// operation (and to the totals).
+void countIO(
+    IOCounter counter,  // in: counter
+    uint64_t amount = 1 // in: amount to add
+);
+
+//--------------------------------------------------
+// Returns the counts of every operation added together.
+IOCounts ioTotals();
+
+//--------------------------------------------------
+// Returns the counts charged to 'name' (zero if none were).
+IOCounts ioCountsFor(
+    const std::string &name // in: operation name
+);
+
+//--------------------------------------------------
+// Returns the counts of every operation charged with any work,
+// sorted by name.
+std::vector<std::pair<std::string, IOCounts> > ioSnapshots();
+
+//--------------------------------------------------
+// Zeroes every counter, e.g. at the start of a shift.
+void resetIOStats();
+
+//--------------------------------------------------
+// Writes one line per operation and a total line.
+void writeIOStats(
+    std::ostream &out // out: table
+);
+
+//--------------------------------------------------
+// Makes an operation the calling thread's top-level operation
+// for the scope, unless one is already open.
+class IOScope
+{
+public:
+    explicit IOScope(
+        IOStat &stat // in: operation to charge
+    );
+    ~IOScope();
+
+private:
+    bool outermost;
+
+    IOScope(const IOScope &);
+    IOScope &operator=(const IOScope &);
+};
+
+#endif // IO_STATS_H
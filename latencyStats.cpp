@@ -0,0 +1,237 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the latency statistics declared in
+//   latencyStats.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial latency histograms.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Timed calls are written to the span trace when it is
+//            open.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Each histogram has the I/O counters of its operation;
+//            the statistics dump includes the I/O table.
+//************************************************************
+
+#include "latencyStats.h"
+#include "spanTrace.h"
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+
+//--------------------------------------------------
+// Every registered histogram by name, and when the current
+// statistics period started. Histograms are never freed.
+static std::mutex registryLock;
+static std::map<std::string, LatencyStat *> &registry()
+{
+    static std::map<std::string, LatencyStat *> stats;
+    return stats;
+}
+static std::chrono::steady_clock::time_point periodStarted = std::chrono::steady_clock::now();
+
+//--------------------------------------------------
+// Function: bucketOf
+//--------------------------------------------------
+// Returns the bucket a duration falls in: durations below 32 ns
+// have a bucket each; above that, each power of two is split
+// into LATENCY_SUB_BUCKETS equal parts.
+static size_t bucketOf(uint64_t nanos)
+{
+    if (nanos < 2 * LATENCY_SUB_BUCKETS)
+        return static_cast<size_t>(nanos);
+    unsigned topBit = 63 - static_cast<unsigned>(__builtin_clzll(nanos));
+    unsigned shift = topBit - 4; // keeps the top five bits, 16-31
+    return shift * LATENCY_SUB_BUCKETS + static_cast<size_t>(nanos >> shift);
+}
+
+//--------------------------------------------------
+// Function: bucketLimit
+//--------------------------------------------------
+// Returns the longest duration that falls in a bucket.
+static uint64_t bucketLimit(size_t bucket)
+{
+    if (bucket < 2 * LATENCY_SUB_BUCKETS)
+        return bucket;
+    unsigned shift = static_cast<unsigned>(bucket / LATENCY_SUB_BUCKETS) - 1;
+    uint64_t sub = bucket % LATENCY_SUB_BUCKETS + LATENCY_SUB_BUCKETS;
+    return ((sub + 1) << shift) - 1;
+}
+
+double LatencySnapshot::meanMicros() const
+{
+    return calls == 0 ? 0.0 : static_cast<double>(totalNanos) / calls / 1000.0;
+}
+
+double LatencySnapshot::percentileMicros(double fraction) const
+{
+    uint64_t recorded = 0;
+    // Loop goal: Count the calls in the buckets (calls may have moved on since)
+    for (uint64_t c : counts)
+        recorded += c;
+    if (recorded == 0)
+        return 0.0;
+
+    uint64_t rank = static_cast<uint64_t>(fraction * recorded + 0.999999);
+    if (rank == 0)
+        rank = 1;
+    uint64_t seen = 0;
+    // Loop goal: Find the bucket holding the call at 'rank'
+    for (size_t i = 0; i < counts.size(); ++i)
+    {
+        seen += counts[i];
+        if (seen >= rank)
+        {
+            uint64_t limit = bucketLimit(i);
+            return static_cast<double>(limit < maxNanos ? limit : maxNanos) / 1000.0;
+        }
+    }
+    return static_cast<double>(maxNanos) / 1000.0;
+}
+
+LatencyStat::LatencyStat(const std::string &name)
+    : statName(name), ioCounters(ioStat(name.c_str())), calls(0), errors(0), totalNanos(0), maxNanos(0)
+{
+    // Loop goal: Start every bucket empty
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i)
+        counts[i].store(0, std::memory_order_relaxed);
+}
+
+void LatencyStat::record(uint64_t nanos, bool failed)
+{
+    counts[bucketOf(nanos)].fetch_add(1, std::memory_order_relaxed);
+    calls.fetch_add(1, std::memory_order_relaxed);
+    totalNanos.fetch_add(nanos, std::memory_order_relaxed);
+    if (failed)
+        errors.fetch_add(1, std::memory_order_relaxed);
+    uint64_t longest = maxNanos.load(std::memory_order_relaxed);
+    // Loop goal: Raise the maximum unless another call raised it further
+    while (nanos > longest &&
+           !maxNanos.compare_exchange_weak(longest, nanos, std::memory_order_relaxed))
+    {
+    }
+}
+
+LatencySnapshot LatencyStat::snapshot() const
+{
+    LatencySnapshot s;
+    s.name = statName;
+    s.calls = calls.load(std::memory_order_relaxed);
+    s.errors = errors.load(std::memory_order_relaxed);
+    s.totalNanos = totalNanos.load(std::memory_order_relaxed);
+    s.maxNanos = maxNanos.load(std::memory_order_relaxed);
+    s.counts.resize(LATENCY_BUCKETS);
+    // Loop goal: Copy each bucket count
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i)
+        s.counts[i] = counts[i].load(std::memory_order_relaxed);
+    return s;
+}
+
+void LatencyStat::reset()
+{
+    // Loop goal: Empty every bucket
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i)
+        counts[i].store(0, std::memory_order_relaxed);
+    calls.store(0, std::memory_order_relaxed);
+    errors.store(0, std::memory_order_relaxed);
+    totalNanos.store(0, std::memory_order_relaxed);
+    maxNanos.store(0, std::memory_order_relaxed);
+}
+
+LatencyStat &latencyStat(const char *name)
+{
+    std::lock_guard<std::mutex> hold(registryLock);
+    LatencyStat *&stat = registry()[name];
+    if (stat == NULL)
+        stat = new LatencyStat(name);
+    return *stat;
+}
+
+std::vector<LatencySnapshot> latencySnapshots()
+{
+    std::vector<LatencySnapshot> snapshots;
+    std::lock_guard<std::mutex> hold(registryLock);
+    // Loop goal: Copy every histogram that has recorded a call, in name order
+    for (const auto &entry : registry())
+    {
+        LatencySnapshot s = entry.second->snapshot();
+        if (s.calls > 0)
+            snapshots.push_back(s);
+    }
+    return snapshots;
+}
+
+void resetLatencyStats()
+{
+    std::lock_guard<std::mutex> hold(registryLock);
+    // Loop goal: Empty every histogram
+    for (const auto &entry : registry())
+        entry.second->reset();
+    periodStarted = std::chrono::steady_clock::now();
+}
+
+void writeLatencyStats(std::ostream &out)
+{
+    std::vector<LatencySnapshot> snapshots = latencySnapshots();
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << "Latency in microseconds:\n";
+    out << "  " << std::left << std::setw(40) << "operation" << std::right
+        << std::setw(9) << "calls" << std::setw(7) << "errors"
+        << std::setw(11) << "mean" << std::setw(11) << "p50" << std::setw(11) << "p90"
+        << std::setw(11) << "p99" << std::setw(11) << "p99.9" << std::setw(11) << "max" << "\n";
+    out << std::fixed << std::setprecision(1);
+    // Loop goal: Write one line per operation
+    for (const LatencySnapshot &s : snapshots)
+    {
+        out << "  " << std::left << std::setw(40) << s.name << std::right
+            << std::setw(9) << s.calls << std::setw(7) << s.errors
+            << std::setw(11) << s.meanMicros()
+            << std::setw(11) << s.percentileMicros(0.50)
+            << std::setw(11) << s.percentileMicros(0.90)
+            << std::setw(11) << s.percentileMicros(0.99)
+            << std::setw(11) << s.percentileMicros(0.999)
+            << std::setw(11) << s.maxNanos / 1000.0 << "\n";
+    }
+    if (snapshots.empty())
+        out << "  (no operations recorded)\n";
+    out.flags(flags);
+    out.precision(precision);
+}
+
+bool dumpLatencyStats(const std::string &path)
+{
+    std::ofstream file(path.c_str(), std::ios::out | std::ios::app);
+    if (!file.is_open())
+        return false;
+
+    std::time_t now = std::time(NULL);
+    char stamp[32];
+    std::strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", std::localtime(&now));
+    long long seconds = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now() - periodStarted).count();
+    file << "# " << stamp << " - statistics over the last " << seconds << " s\n";
+    writeLatencyStats(file);
+    writeIOStats(file);
+    file << "\n";
+    return static_cast<bool>(file);
+}
+
+LatencyTimer::~LatencyTimer()
+{
+    std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+    uint64_t nanos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        finished - started).count());
+    bool callFailed = failed || std::uncaught_exception();
+    stat.record(nanos, callFailed);
+    if (spanTracing())
+        writeSpan(stat.name().c_str(), started, finished, callFailed);
+}
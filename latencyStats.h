@@ -0,0 +1,221 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the latency statistics: one histogram per store
+//   operation and core API call, with call and error counts,
+//   always on, so the Statistics menu and the shutdown dump can
+//   show where time goes (for example p99 check-in latency over
+//   a shift).
+//************************************************************
+// USAGE:
+// - Time a function by keeping its histogram in a function-local
+//   static and opening a LatencyTimer for the call:
+//       static LatencyStat &stat = latencyStat("reservation::checkIn");
+//       LatencyTimer timer(stat);
+//   Mark a failed call with timer.fail(), or pass the result
+//   through timer.result(ok) or timer.failWith(-1). A call that
+//   ends by throwing counts as an error.
+// - The outermost timed call on a thread is the top-level
+//   operation charged with storage I/O (ioStats.h).
+// - While a span trace is open (spanTrace.h) each timed call is
+//   also written as a span under the histogram's name.
+// - writeLatencyStats() prints the table; dumpLatencyStats()
+//   appends it to a file with a timestamp (ferry_system does this
+//   on shutdown); resetLatencyStats() starts a new period.
+//
+// Histograms are log-linear, like an HDR histogram: durations
+// are kept in nanoseconds, in buckets 1/16 of a power of two
+// wide, so any percentile is within about 6% of the true value
+// from 1 ns to hours. Timing uses steady_clock, a monotonic
+// clock read through the vDSO; recording is a few relaxed
+// atomic adds with no lock.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial latency histograms.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Timed calls are written to the span trace when it is
+//            open.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Each histogram has the I/O counters of its operation,
+//            and a timed call is an IOScope (ioStats.h).
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include "ioStats.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// linear sub-buckets per power of two (a power of two itself)
+const unsigned LATENCY_SUB_BUCKETS = 16;
+// buckets covering every 64-bit nanosecond count: one each below
+// 32 ns, then LATENCY_SUB_BUCKETS per power of two up to 2^64
+const size_t LATENCY_BUCKETS = (64 - 3) * LATENCY_SUB_BUCKETS;
+
+//--------------------------------------------------
+// Copy of one histogram taken at a point in time.
+struct LatencySnapshot
+{
+    std::string name;             // operation name
+    uint64_t calls;               // calls recorded
+    uint64_t errors;              // calls that failed
+    uint64_t totalNanos;          // sum of all durations
+    uint64_t maxNanos;            // longest call
+    std::vector<uint64_t> counts; // calls per bucket
+
+    //--------------------------------------------------
+    // Returns the mean duration in microseconds (0 with no calls).
+    double meanMicros() const;
+
+    //--------------------------------------------------
+    // Returns the duration in microseconds that 'fraction' of the
+    // calls took at most, e.g. 0.99 for p99 (0 with no calls).
+    double percentileMicros(
+        double fraction // in: 0 to 1
+    ) const;
+};
+
+//--------------------------------------------------
+// Histogram, call count and error count of one operation.
+class LatencyStat
+{
+public:
+    explicit LatencyStat(
+        const std::string &name // in: operation name
+    );
+
+    // Adds one call that took 'nanos'.
+    void record(
+        uint64_t nanos, // in: duration in nanoseconds
+        bool failed     // in: true if the call failed
+    );
+
+    // Returns a consistent-enough copy for reporting.
+    LatencySnapshot snapshot() const;
+
+    // Forgets every recorded call.
+    void reset();
+
+    // Returns the operation name.
+    const std::string &name() const
+    {
+        return statName;
+    }
+
+    // Returns the storage I/O counters of the operation.
+    IOStat &io() const
+    {
+        return ioCounters;
+    }
+
+private:
+    std::string statName;
+    IOStat &ioCounters;
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> errors;
+    std::atomic<uint64_t> totalNanos;
+    std::atomic<uint64_t> maxNanos;
+    std::atomic<uint64_t> counts[LATENCY_BUCKETS];
+
+    LatencyStat(const LatencyStat &);
+    LatencyStat &operator=(const LatencyStat &);
+};
+
+//--------------------------------------------------
+// Returns the histogram registered under 'name', creating it on
+// first use. Histograms live until the program ends, so the
+// reference can be kept in a static.
+LatencyStat &latencyStat(
+    const char *name // in: operation name
+);
+
+//--------------------------------------------------
+// Returns a snapshot of every histogram with at least one call,
+// sorted by name.
+std::vector<LatencySnapshot> latencySnapshots();
+
+//--------------------------------------------------
+// Forgets every recorded call, e.g. at the start of a shift.
+void resetLatencyStats();
+
+//--------------------------------------------------
+// Writes one line per operation: calls, errors, then mean, p50,
+// p90, p99, p99.9 and max in microseconds.
+void writeLatencyStats(
+    std::ostream &out // out: table
+);
+
+//--------------------------------------------------
+// Appends the table and the storage I/O table to 'path', under
+// a line with the local time and the time since the last reset.
+// Returns false if the file cannot be written.
+bool dumpLatencyStats(
+    const std::string &path // in: file to append to
+);
+
+//--------------------------------------------------
+// Times one call into a histogram; records it (and writes its
+// span, while span tracing) when the scope ends. Storage I/O
+// inside it is charged to this operation unless an outer one is
+// open.
+class LatencyTimer
+{
+public:
+    explicit LatencyTimer(
+        LatencyStat &stat // in: histogram to record into
+    )
+        : stat(stat), ioScope(stat.io()), failed(false), started(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~LatencyTimer();
+
+    // Counts this call as an error.
+    void fail()
+    {
+        failed = true;
+    }
+
+    // Counts this call as an error if 'ok' is false; returns 'ok'.
+    bool result(
+        bool ok // in: whether the call succeeded
+    )
+    {
+        if (!ok)
+            failed = true;
+        return ok;
+    }
+
+    // Counts this call as an error; returns 'value', the failure
+    // result of the caller (e.g. -1).
+    template <typename T>
+    T failWith(
+        T value // in: value the caller returns on failure
+    )
+    {
+        failed = true;
+        return value;
+    }
+
+private:
+    LatencyStat &stat;
+    IOScope ioScope;
+    bool failed;
+    std::chrono::steady_clock::time_point started;
+
+    LatencyTimer(const LatencyTimer &);
+    LatencyTimer &operator=(const LatencyTimer &);
+};
+
+#endif // LATENCY_STATS_H
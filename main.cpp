@@ -1,4 +1,4 @@
-// PROJECT: CMPT 276 – Ferry Reservation Software System 
+// PROJECT: CMPT 276 – Ferry Reservation Software System
 // TEAM: Group 19
 // DATE: 2025/07/09
 //************************************************************
@@ -6,19 +6,101 @@
 // Entry point of the Ferry Reservation Software System.
 // Initializes the system, runs the main UI loop, and shuts down // cleanly.
 //************************************************************
+// USAGE:
+// - ferry_system                        interactive menus
+// - ferry_system --batch [FILE]         batch commands from FILE
+//                                       (or stdin)
+// - ferry_system -c "COMMAND ARG..."    batch commands from argv;
+//                                       -c may be repeated
+// Batch mode exits with 0 if every command succeeded, 2 if any
+// failed and 1 on bad usage (see batchCommands.h).
+//************************************************************
 // REVISION HISTORY:
 // Rev. 1 - 2025/07/24 - James Nguyen
 // - Initial version of main.cpp file.
 // Rev. 2 - 2025/08/05 - James Nguyen
 // - Finalized main.cpp to integrate with UI and system modules.
 // - Ensured proper initialization and shutdown sequence.
+// Rev. 3 - 2026/10/18 - Group 19
+// - Added the --batch and -c batch command modes.
 //************************************************************
 
 
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <string>
+#include <vector>
 #include "ui.h"
+#include "batchCommands.h"
+
+//--------------------------------------------------
+// Function: runBatchMode
+//--------------------------------------------------
+// Runs the commands named on the command line (-c) or read from
+// a file or stdin (--batch). Returns the process exit code.
+static int runBatchMode(int argc, char *argv[]) {
+    std::vector<std::string> commands;
+    const char *batchFile = NULL;
+    bool batch = false;
+    // Loop goal: Collect the -c commands or the --batch input
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-c") == 0 && i + 1 < argc && !batch) {
+            commands.push_back(argv[++i]);
+        } else if (strcmp(argv[i], "--batch") == 0 && !batch && commands.empty()) {
+            batch = true;
+            if (i + 1 < argc && strcmp(argv[i + 1], "-") != 0) {
+                batchFile = argv[++i];
+            } else if (i + 1 < argc) {
+                ++i;
+            }
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [--batch [FILE] | -c \"COMMAND ARG...\"...]\n";
+            return 1;
+        }
+    }
+
+    std::ifstream file;
+    if (batchFile != NULL) {
+        file.open(batchFile);
+        if (!file.is_open()) {
+            std::cerr << "Unable to read batch file " << batchFile << ".\n";
+            return 1;
+        }
+    }
+
+    // The start-up and shutdown messages would mix with the results
+    std::streambuf *console = std::cout.rdbuf();
+    std::cout.rdbuf(NULL);
+    bool started = UI::initialize();
+    std::cout.rdbuf(console);
+    if (!started) {
+        std::cerr << "Initialization failed. Exiting program.\n";
+        return 1;
+    }
+
+    size_t failed = 0;
+    if (batch) {
+        failed = runBatch(batchFile != NULL ? static_cast<std::istream &>(file) : std::cin, std::cout);
+    } else {
+        // Loop goal: Run each command given on the command line
+        for (const auto &command : commands) {
+            if (!runCommand(command, std::cout))
+                ++failed;
+        }
+    }
+
+    std::cout.rdbuf(NULL);
+    UI::shutdown();
+    std::cout.rdbuf(console);
+    return failed == 0 ? 0 : 2;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        return runBatchMode(argc, argv);
+    }
 
-int main() {
     // Initialize system modules
     if (!UI::initialize()) {
         std::cerr << "Initialization failed. Exiting program.\n";
@@ -0,0 +1,162 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the operation trace declared in operationTrace.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial trace recorder and reader.
+//************************************************************
+
+#include "operationTrace.h"
+#include <cstdlib>
+#include <fstream>
+
+//--------------------------------------------------
+// The open trace and the time its clock starts from
+static std::ofstream traceFile;
+static std::chrono::steady_clock::time_point traceStarted;
+
+//--------------------------------------------------
+// Function: microsSince
+//--------------------------------------------------
+// Returns whole microseconds from 'from' to 'to'.
+static long long microsSince(std::chrono::steady_clock::time_point from,
+                             std::chrono::steady_clock::time_point to)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(to - from).count();
+}
+
+//--------------------------------------------------
+// Function: escapeField
+//--------------------------------------------------
+// Escapes the characters that would break a trace line.
+static std::string escapeField(const std::string &field)
+{
+    std::string out;
+    // Loop goal: Copy each character, escaping tabs, newlines and backslashes
+    for (char c : field)
+    {
+        if (c == '\t')
+            out += "\\t";
+        else if (c == '\n')
+            out += "\\n";
+        else if (c == '\\')
+            out += "\\\\";
+        else
+            out += c;
+    }
+    return out;
+}
+
+//--------------------------------------------------
+// Function: unescapeField
+//--------------------------------------------------
+// Reverses escapeField().
+static std::string unescapeField(const std::string &field)
+{
+    std::string out;
+    // Loop goal: Copy each character, decoding escape pairs
+    for (size_t i = 0; i < field.size(); ++i)
+    {
+        if (field[i] == '\\' && i + 1 < field.size())
+        {
+            char next = field[++i];
+            out += next == 't' ? '\t' : next == 'n' ? '\n' : next;
+        }
+        else
+        {
+            out += field[i];
+        }
+    }
+    return out;
+}
+
+bool startTrace(const std::string &path)
+{
+    stopTrace();
+    traceFile.open(path, std::ios::out | std::ios::trunc);
+    if (!traceFile.is_open())
+        return false;
+    traceFile << "# start-us\tduration-us\toperation\targs...\n";
+    traceStarted = std::chrono::steady_clock::now();
+    return true;
+}
+
+void stopTrace()
+{
+    if (traceFile.is_open())
+        traceFile.close();
+}
+
+bool tracing()
+{
+    return traceFile.is_open();
+}
+
+bool readTrace(const std::string &path, std::vector<TraceEvent> &events)
+{
+    std::ifstream in(path);
+    if (!in.is_open())
+        return false;
+
+    std::string line;
+    // Loop goal: Parse each operation line, skipping comments and blanks
+    while (std::getline(in, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::vector<std::string> fields;
+        size_t begin = 0;
+        // Loop goal: Split the line at each tab
+        while (true)
+        {
+            size_t tab = line.find('\t', begin);
+            fields.push_back(unescapeField(line.substr(begin, tab - begin)));
+            if (tab == std::string::npos)
+                break;
+            begin = tab + 1;
+        }
+        if (fields.size() < 3)
+            return false;
+
+        TraceEvent event;
+        char *end = NULL;
+        event.startMicros = std::strtoll(fields[0].c_str(), &end, 10);
+        if (*end != '\0')
+            return false;
+        event.durationMicros = std::strtoll(fields[1].c_str(), &end, 10);
+        if (*end != '\0')
+            return false;
+        event.operation = fields[2];
+        event.args.assign(fields.begin() + 3, fields.end());
+        events.push_back(event);
+    }
+    return true;
+}
+
+TraceScope::TraceScope(const char *operation)
+    : active(tracing()),
+      operation(operation)
+{
+    if (active)
+        started = std::chrono::steady_clock::now();
+}
+
+TraceScope::~TraceScope()
+{
+    if (!active || !traceFile.is_open())
+        return;
+    std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+    traceFile << microsSince(traceStarted, started) << '\t'
+              << microsSince(started, finished) << '\t' << operation;
+    // Loop goal: Append each argument as its own field
+    for (const auto &value : args)
+    {
+        traceFile << '\t' << escapeField(value);
+    }
+    traceFile << '\n';
+}
@@ -0,0 +1,116 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the operation trace: an optional log of every
+//   high-level operation the user interface hands to the core
+//   modules, with its start time, duration and arguments, so a
+//   session can be replayed without a keyboard (see replay.cpp).
+//************************************************************
+// USAGE:
+// - startTrace() opens the log (ferry_system does this when the
+//   FRSS_TRACE environment variable names a file); stopTrace()
+//   closes it.
+// - Wrap each operation in a TraceScope and add its arguments:
+//       TraceScope trace("checkIn");
+//       trace.arg(sailingID).arg(plate);
+//   The line is written when the scope ends. With tracing off a
+//   TraceScope does nothing.
+// - readTrace() loads a log back for replay.
+//
+// File format: one operation per line, tab separated:
+//   start-us  duration-us  operation  arg...
+// Times are microseconds from startTrace(). Tabs, newlines and
+// backslashes inside arguments are written as \t, \n and \\.
+// Lines starting with '#' are comments.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial trace recorder and reader.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef OPERATION_TRACE_H
+#define OPERATION_TRACE_H
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------
+// One recorded operation.
+struct TraceEvent
+{
+    long long startMicros;         // start, in microseconds from startTrace()
+    long long durationMicros;      // how long the operation took
+    std::string operation;         // operation name, e.g. "addReservation"
+    std::vector<std::string> args; // arguments, as text
+};
+
+//--------------------------------------------------
+// Starts writing the trace to 'path' (replacing the file).
+// Returns false if the file cannot be created.
+bool startTrace(
+    const std::string &path // in: trace file to write
+);
+
+//--------------------------------------------------
+// Flushes and closes the trace, if one is being written.
+void stopTrace();
+
+//--------------------------------------------------
+// Returns true while a trace is being written.
+bool tracing();
+
+//--------------------------------------------------
+// Reads every operation in a trace file, in file order.
+// Returns false if the file cannot be opened or a line is
+// malformed.
+bool readTrace(
+    const std::string &path,        // in:  trace file to read
+    std::vector<TraceEvent> &events // out: operations read
+);
+
+//--------------------------------------------------
+// Times one operation and writes it to the trace when the scope
+// ends. Arguments are kept only while tracing.
+class TraceScope
+{
+public:
+    explicit TraceScope(
+        const char *operation // in: operation name (a literal)
+    );
+    ~TraceScope();
+
+    // Adds the next argument. Floats keep nine significant digits
+    // so they read back unchanged; bools are written as 1 or 0.
+    template <typename T>
+    TraceScope &arg(
+        const T &value // in: argument value
+    )
+    {
+        if (active)
+        {
+            std::ostringstream text;
+            text.precision(9);
+            text << value;
+            args.push_back(text.str());
+        }
+        return *this;
+    }
+
+private:
+    bool active;
+    const char *operation;
+    std::chrono::steady_clock::time_point started;
+    std::vector<std::string> args;
+
+    TraceScope(const TraceScope &);
+    TraceScope &operator=(const TraceScope &);
+};
+
+#endif // OPERATION_TRACE_H
@@ -0,0 +1,174 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the performance counters declared in
+//   perfCounters.h. Elsewhere than Linux every counter is
+//   unavailable.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial perf_event_open counters.
+//************************************************************
+
+#include "perfCounters.h"
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//--------------------------------------------------
+// perf_event_open event of each counter, in PerfCounter order.
+static const uint64_t EVENTS[PERF_COUNTER_COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+//--------------------------------------------------
+// Function: openCounter
+//--------------------------------------------------
+// Opens one hardware event for the calling thread, user space
+// only and disabled. Returns the file, or -1 with errno set.
+static int openCounter(uint64_t event)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = event;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // The enabled and running times scale the count if the kernel
+    // had to share the PMU between more events than it has
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+#endif
+
+const char *perfCounterName(PerfCounter counter)
+{
+    static const char *const NAMES[PERF_COUNTER_COUNT] = {
+        "cycles", "instructions", "cache-misses", "branch-misses"};
+    return NAMES[counter];
+}
+
+PerfCounts::PerfCounts()
+{
+    // Loop goal: Start every counter at zero and unavailable
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        value[i] = 0;
+        available[i] = false;
+    }
+}
+
+double PerfCounts::ipc() const
+{
+    if (!available[PERF_CYCLES] || !available[PERF_INSTRUCTIONS] || value[PERF_CYCLES] == 0)
+        return 0.0;
+    return static_cast<double>(value[PERF_INSTRUCTIONS]) / value[PERF_CYCLES];
+}
+
+PerfCounters::PerfCounters()
+{
+#ifdef __linux__
+    // Loop goal: Open each counter, keeping the first error
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        fds[i] = openCounter(EVENTS[i]);
+        if (fds[i] < 0 && reason.empty())
+            reason = std::string("perf_event_open: ") + std::strerror(errno);
+    }
+    if (available())
+        reason.clear();
+#else
+    // Loop goal: Mark each counter unavailable
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+        fds[i] = -1;
+    reason = "perf_event_open is only available on Linux";
+#endif
+}
+
+PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    // Loop goal: Close each open counter
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        if (fds[i] >= 0)
+            ::close(fds[i]);
+    }
+#endif
+}
+
+bool PerfCounters::available() const
+{
+    // Loop goal: Look for any counter that opened
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        if (fds[i] >= 0)
+            return true;
+    }
+    return false;
+}
+
+void PerfCounters::start()
+{
+#ifdef __linux__
+    // Loop goal: Enable each open counter
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        if (fds[i] >= 0)
+            ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+void PerfCounters::stop()
+{
+#ifdef __linux__
+    // Loop goal: Disable each open counter
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        if (fds[i] >= 0)
+            ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+#endif
+}
+
+void PerfCounters::reset()
+{
+#ifdef __linux__
+    // Loop goal: Zero each open counter
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        if (fds[i] >= 0)
+            ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+    }
+#endif
+}
+
+PerfCounts PerfCounters::read() const
+{
+    PerfCounts counts;
+#ifdef __linux__
+    // Loop goal: Read each open counter, scaled to the time it was enabled
+    for (size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+    {
+        uint64_t data[3]; // value, time enabled, time running
+        if (fds[i] < 0 || ::read(fds[i], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+            continue;
+        counts.available[i] = true;
+        if (data[2] > 0 && data[2] < data[1])
+            counts.value[i] = static_cast<uint64_t>(static_cast<double>(data[0]) * data[1] / data[2]);
+        else
+            counts.value[i] = data[0];
+    }
+#endif
+    return counts;
+}
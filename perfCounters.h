@@ -0,0 +1,103 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares hardware performance counters (cycles, instructions,
+//   cache misses, branch misses) read through Linux
+//   perf_event_open, so scans, fare kernels and index lookups can
+//   be compared on IPC and cache behaviour, not only wall time.
+//************************************************************
+// USAGE:
+// - Create a PerfCounters object on the thread to measure; it
+//   opens every counter the kernel allows. Counters that cannot
+//   be opened (no PMU in a VM, perf_event_paranoid, other
+//   systems) are marked unavailable and read as zero; if none
+//   open, available() is false and unavailableReason() says why.
+// - start() and stop() around the code measured; counts add up
+//   until reset(). Only user-space work on the calling thread is
+//   counted (not the kernel, not thread pool workers).
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial perf_event_open counters.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint>
+#include <string>
+
+//--------------------------------------------------
+// Hardware events counted.
+enum PerfCounter
+{
+    PERF_CYCLES,        // CPU cycles
+    PERF_INSTRUCTIONS,  // instructions retired
+    PERF_CACHE_MISSES,  // last-level cache misses
+    PERF_BRANCH_MISSES, // mispredicted branches
+    PERF_COUNTER_COUNT
+};
+
+//--------------------------------------------------
+// Returns the short name of a counter, e.g. "cycles".
+const char *perfCounterName(
+    PerfCounter counter // in: counter
+);
+
+//--------------------------------------------------
+// One reading of every counter.
+struct PerfCounts
+{
+    uint64_t value[PERF_COUNTER_COUNT];  // counts, scaled if the kernel multiplexed
+    bool available[PERF_COUNTER_COUNT];  // false if the counter could not be opened
+
+    PerfCounts();
+
+    // Returns instructions per cycle, or 0 if either is missing.
+    double ipc() const;
+};
+
+//--------------------------------------------------
+// The counters of the calling thread.
+class PerfCounters
+{
+public:
+    // Opens each counter, disabled and at zero.
+    PerfCounters();
+    ~PerfCounters();
+
+    // Returns true if at least one counter opened.
+    bool available() const;
+
+    // Returns why no counter opened (empty if one did).
+    const std::string &unavailableReason() const
+    {
+        return reason;
+    }
+
+    // Starts counting.
+    void start();
+
+    // Stops counting; the counts are kept.
+    void stop();
+
+    // Zeroes every counter.
+    void reset();
+
+    // Returns the counts so far.
+    PerfCounts read() const;
+
+private:
+    int fds[PERF_COUNTER_COUNT]; // one file per counter, -1 if unavailable
+    std::string reason;
+
+    PerfCounters(const PerfCounters &);
+    PerfCounters &operator=(const PerfCounters &);
+};
+
+#endif // PERF_COUNTERS_H
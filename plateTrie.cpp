@@ -0,0 +1,307 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the compressed plate trie declared in
+//   plateTrie.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial compressed trie with prefix and edit
+//          distance search.
+//************************************************************
+
+#include "plateTrie.h"
+#include <algorithm>
+#include <cctype>
+
+//--------------------------------------------------
+// Function: fold
+//--------------------------------------------------
+// Upper-cases a character so searches ignore letter case.
+static char fold(char c)
+{
+    return static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+}
+
+PlateTrie::PlateTrie()
+    : count(0)
+{
+}
+
+void PlateTrie::clear()
+{
+    root.children.clear();
+    root.terminal = false;
+    count = 0;
+}
+
+std::vector<std::unique_ptr<PlateTrie::Node>>::iterator PlateTrie::childSlot(Node &node, char c)
+{
+    return std::lower_bound(node.children.begin(), node.children.end(), c,
+        [](const std::unique_ptr<Node> &child, char key)
+        {
+            return static_cast<unsigned char>(child->label[0]) < static_cast<unsigned char>(key);
+        });
+}
+
+bool PlateTrie::insert(const std::string &plate)
+{
+    if (plate.empty())
+        return false;
+
+    Node *node = &root;
+    size_t pos = 0;
+    // Loop goal: Follow or split edges until the plate is placed
+    while (true)
+    {
+        if (pos == plate.size())
+        {
+            if (node->terminal)
+                return false;
+            node->terminal = true;
+            ++count;
+            return true;
+        }
+
+        std::vector<std::unique_ptr<Node>>::iterator slot = childSlot(*node, plate[pos]);
+        if (slot == node->children.end() || (*slot)->label[0] != plate[pos])
+        {
+            // No edge starts with this character: hang the rest here
+            std::unique_ptr<Node> leaf(new Node());
+            leaf->label = plate.substr(pos);
+            leaf->terminal = true;
+            node->children.insert(slot, std::move(leaf));
+            ++count;
+            return true;
+        }
+
+        Node &child = **slot;
+        size_t common = 0;
+        // Loop goal: Measure how much of the edge the plate shares
+        while (common < child.label.size() && pos + common < plate.size() &&
+               child.label[common] == plate[pos + common])
+        {
+            ++common;
+        }
+
+        if (common < child.label.size())
+        {
+            // Split the edge at the first difference
+            std::unique_ptr<Node> middle(new Node());
+            middle->label = child.label.substr(0, common);
+            child.label.erase(0, common);
+            middle->children.push_back(std::move(*slot));
+            *slot = std::move(middle);
+        }
+        node = slot->get();
+        pos += common;
+    }
+}
+
+void PlateTrie::mergeChild(Node &child)
+{
+    if (child.terminal || child.children.size() != 1)
+        return;
+    std::unique_ptr<Node> only = std::move(child.children[0]);
+    child.label += only->label;
+    child.terminal = only->terminal;
+    child.children = std::move(only->children);
+}
+
+bool PlateTrie::eraseFrom(Node &node, const std::string &plate, size_t pos)
+{
+    if (pos == plate.size())
+    {
+        if (!node.terminal)
+            return false;
+        node.terminal = false;
+        return true;
+    }
+
+    std::vector<std::unique_ptr<Node>>::iterator slot = childSlot(node, plate[pos]);
+    if (slot == node.children.end() || (*slot)->label[0] != plate[pos])
+        return false;
+    Node &child = **slot;
+    if (plate.compare(pos, child.label.size(), child.label) != 0)
+        return false;
+    if (!eraseFrom(child, plate, pos + child.label.size()))
+        return false;
+
+    // Drop a child left empty, or fold a lone grandchild into it
+    if (!child.terminal && child.children.empty())
+        node.children.erase(slot);
+    else
+        mergeChild(child);
+    return true;
+}
+
+bool PlateTrie::erase(const std::string &plate)
+{
+    if (plate.empty() || !eraseFrom(root, plate, 0))
+        return false;
+    --count;
+    return true;
+}
+
+bool PlateTrie::contains(const std::string &plate) const
+{
+    const Node *node = &root;
+    size_t pos = 0;
+    // Loop goal: Follow whole edges until the plate is used up
+    while (pos < plate.size())
+    {
+        const Node *next = NULL;
+        // Loop goal: Find the child whose edge starts with this character
+        for (const auto &child : node->children)
+        {
+            if (child->label[0] == plate[pos])
+            {
+                next = child.get();
+                break;
+            }
+        }
+        if (next == NULL || plate.compare(pos, next->label.size(), next->label) != 0)
+            return false;
+        pos += next->label.size();
+        node = next;
+    }
+    return !plate.empty() && node->terminal;
+}
+
+size_t PlateTrie::size() const
+{
+    return count;
+}
+
+void PlateTrie::collect(const Node &node, std::string &path,
+                        std::vector<std::string> &out, size_t limit)
+{
+    if (limit != 0 && out.size() >= limit)
+        return;
+    if (node.terminal)
+        out.push_back(path);
+    // Loop goal: Visit the children in character order
+    for (const auto &child : node.children)
+    {
+        size_t length = path.size();
+        path += child->label;
+        collect(*child, path, out, limit);
+        path.resize(length);
+    }
+}
+
+void PlateTrie::prefixWalk(const Node &node, std::string &path, const std::string &prefix,
+                           size_t matched, std::vector<std::string> &out, size_t limit)
+{
+    // Loop goal: Descend into every child whose edge agrees with the
+    // prefix (upper and lower case can both agree)
+    for (const auto &child : node.children)
+    {
+        if (limit != 0 && out.size() >= limit)
+            return;
+        const std::string &label = child->label;
+        size_t k = 0;
+        while (k < label.size() && matched + k < prefix.size() &&
+               fold(label[k]) == fold(prefix[matched + k]))
+        {
+            ++k;
+        }
+        if (k < label.size() && matched + k < prefix.size())
+            continue; // mismatch inside the edge
+
+        size_t length = path.size();
+        path += label;
+        if (matched + k == prefix.size())
+            collect(*child, path, out, limit);
+        else
+            prefixWalk(*child, path, prefix, matched + k, out, limit);
+        path.resize(length);
+    }
+}
+
+std::vector<std::string> PlateTrie::withPrefix(const std::string &prefix, size_t limit) const
+{
+    std::vector<std::string> out;
+    std::string path;
+    if (prefix.empty())
+        collect(root, path, out, limit);
+    else
+        prefixWalk(root, path, prefix, 0, out, limit);
+    return out;
+}
+
+void PlateTrie::distanceWalk(const Node &node, std::string &path, const std::string &query,
+                             const std::vector<int> &row, int maxDistance,
+                             std::vector<PlateMatch> &out)
+{
+    // Loop goal: Extend the distance table along each child's edge
+    for (const auto &child : node.children)
+    {
+        std::vector<int> current = row;
+        std::vector<int> next(row.size());
+        bool pruned = false;
+        // Loop goal: Add one table row per edge character, giving up
+        // once every entry is over the limit
+        for (char c : child->label)
+        {
+            next[0] = current[0] + 1;
+            int best = next[0];
+            // Loop goal: Fill the row from left to right
+            for (size_t j = 1; j < next.size(); ++j)
+            {
+                int substitute = current[j - 1] + (fold(query[j - 1]) == fold(c) ? 0 : 1);
+                next[j] = std::min(std::min(current[j] + 1, next[j - 1] + 1), substitute);
+                best = std::min(best, next[j]);
+            }
+            current.swap(next);
+            if (best > maxDistance)
+            {
+                pruned = true;
+                break;
+            }
+        }
+        if (pruned)
+            continue;
+
+        size_t length = path.size();
+        path += child->label;
+        if (child->terminal && current.back() <= maxDistance)
+        {
+            PlateMatch match;
+            match.licensePlate = path;
+            match.distance = current.back();
+            out.push_back(match);
+        }
+        distanceWalk(*child, path, query, current, maxDistance, out);
+        path.resize(length);
+    }
+}
+
+std::vector<PlateMatch> PlateTrie::withinDistance(const std::string &plate, int maxDistance,
+                                                  size_t limit) const
+{
+    std::vector<PlateMatch> out;
+    if (maxDistance < 0)
+        return out;
+
+    // Distance from the empty path to each prefix of the query
+    std::vector<int> row(plate.size() + 1);
+    // Loop goal: Fill the first table row with 0, 1, 2, ...
+    for (size_t j = 0; j < row.size(); ++j)
+    {
+        row[j] = static_cast<int>(j);
+    }
+    std::string path;
+    distanceWalk(root, path, plate, row, maxDistance, out);
+
+    std::sort(out.begin(), out.end(), [](const PlateMatch &a, const PlateMatch &b)
+    {
+        return a.distance != b.distance ? a.distance < b.distance
+                                        : a.licensePlate < b.licensePlate;
+    });
+    if (limit != 0 && out.size() > limit)
+        out.resize(limit);
+    return out;
+}
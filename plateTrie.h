@@ -0,0 +1,125 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares an in-memory compressed trie (radix tree) of
+//   license plates for partial and misread plate searches.
+//   Each edge holds a run of characters, so a chain of
+//   single-child nodes collapses into one node.
+//************************************************************
+// USAGE:
+// - insert() and erase() keep the trie in step with the
+//   vehicle file.
+// - withPrefix() lists plates starting with what the agent
+//   typed; withinDistance() lists plates within a few typing
+//   errors of it. Both ignore letter case.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial compressed trie with prefix and edit
+//          distance search.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef PLATE_TRIE_H
+#define PLATE_TRIE_H
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------
+// A plate found by a fuzzy search.
+struct PlateMatch
+{
+    std::string licensePlate; // Plate as stored
+    int distance;             // Edit distance from the query
+};
+
+//--------------------------------------------------
+// Compressed trie over license plates.
+class PlateTrie
+{
+public:
+    PlateTrie();
+
+    // Removes every plate.
+    void clear();
+
+    // Adds a plate. Returns false if it was already present.
+    bool insert(
+        const std::string &plate // in: plate to add
+    );
+
+    // Removes a plate, merging nodes left with a single child.
+    // Returns false if it was not present.
+    bool erase(
+        const std::string &plate // in: plate to remove
+    );
+
+    // Returns true if the exact plate is present.
+    bool contains(
+        const std::string &plate // in: plate to look up
+    ) const;
+
+    // Returns the number of plates stored.
+    size_t size() const;
+
+    // Returns up to 'limit' plates starting with 'prefix'
+    // (0 = no limit), in ascending order.
+    std::vector<std::string> withPrefix(
+        const std::string &prefix, // in: leading characters
+        size_t limit               // in: maximum results
+    ) const;
+
+    // Returns up to 'limit' plates within 'maxDistance'
+    // insertions, deletions or substitutions of 'plate'
+    // (0 = no limit), closest first, ties in ascending order.
+    std::vector<PlateMatch> withinDistance(
+        const std::string &plate, // in: plate as typed
+        int maxDistance,          // in: largest edit distance kept
+        size_t limit              // in: maximum results
+    ) const;
+
+private:
+    // A node and the run of characters on the edge leading to it
+    struct Node
+    {
+        std::string label;                           // edge characters (empty at the root)
+        bool terminal;                               // a plate ends here
+        std::vector<std::unique_ptr<Node>> children; // sorted by first label character
+        Node() : terminal(false) {}
+    };
+
+    Node root;
+    size_t count;
+
+    PlateTrie(const PlateTrie &);
+    PlateTrie &operator=(const PlateTrie &);
+
+    // returns the child slot whose label starts with 'c', or the
+    // slot where such a child would be inserted
+    static std::vector<std::unique_ptr<Node>>::iterator childSlot(Node &node, char c);
+    // removes 'plate' below 'node' from character 'pos' on;
+    // returns true if it was found
+    bool eraseFrom(Node &node, const std::string &plate, size_t pos);
+    // collapses a non-terminal child left with one child of its own
+    static void mergeChild(Node &child);
+    // appends every plate in the subtree under 'node' (whose
+    // path spells 'path') until 'limit' results are held
+    static void collect(const Node &node, std::string &path,
+                        std::vector<std::string> &out, size_t limit);
+    // case-insensitive prefix walk
+    static void prefixWalk(const Node &node, std::string &path, const std::string &prefix,
+                           size_t matched, std::vector<std::string> &out, size_t limit);
+    // edit distance walk carrying one DP row per trie character
+    static void distanceWalk(const Node &node, std::string &path, const std::string &query,
+                             const std::vector<int> &row, int maxDistance,
+                             std::vector<PlateMatch> &out);
+};
+
+#endif // PLATE_TRIE_H
@@ -0,0 +1,41 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements backend selection for the bulk record I/O
+//   helpers declared in recordIO.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial batched/stream record I/O backends.
+//************************************************************
+
+#include "recordIO.h"
+#include <cstdlib>
+#include <cstring>
+
+//--------------------------------------------------
+// Active backend and whether it has been resolved yet
+static IOBackend backend = IO_BACKEND_BATCHED;
+static bool backendResolved = false;
+
+void setIOBackend(IOBackend newBackend)
+{
+    backend = newBackend;
+    backendResolved = true;
+}
+
+IOBackend getIOBackend()
+{
+    if (!backendResolved)
+    {
+        const char *env = std::getenv("FRSS_IO_BACKEND");
+        if (env != NULL && std::strcmp(env, "stream") == 0)
+            backend = IO_BACKEND_STREAM;
+        else
+            backend = IO_BACKEND_BATCHED;
+        backendResolved = true;
+    }
+    return backend;
+}
@@ -0,0 +1,203 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the bulk record I/O helpers shared by the
+//   fixed-length binary stores (sailings, vehicles and
+//   reservations). Whole-file scans and rewrites go through
+//   these helpers so the I/O strategy can be chosen at runtime.
+//************************************************************
+// USAGE:
+// - Call readAllRecords() instead of looping file.read() per
+//   record when a whole store must be scanned.
+// - Call writeAllRecords() when a store is rewritten after a
+//   deletion.
+// - The backend defaults to batched I/O; set the environment
+//   variable FRSS_IO_BACKEND=stream (or call setIOBackend())
+//   to fall back to the original one-record-per-call path.
+// - Call flushRecords() to push a store's writes to disk.
+// - Call readRecordAt()/writeRecordAt() for one record in place.
+// - Scans, rewrites and flushes are spans in the span trace, and
+//   every helper counts its reads, writes, seeks, flushes and
+//   scans in the storage I/O counters (ioStats.h).
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial batched/stream record I/O backends.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Added flushRecords(); scans, rewrites and flushes are
+//            span trace spans.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Added readRecordAt()/writeRecordAt(); the helpers
+//            count their storage I/O.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef RECORD_IO_H
+#define RECORD_IO_H
+
+#include "ioStats.h"
+#include "spanTrace.h"
+#include <fstream>
+#include <vector>
+
+//--------------------------------------------------
+// Strategy used by the stores for whole-file reads and writes.
+enum IOBackend
+{
+    IO_BACKEND_STREAM, // one read()/write() call per record
+    IO_BACKEND_BATCHED // whole file moved in a single call
+};
+
+//--------------------------------------------------
+// Selects the backend used by readAllRecords()/writeAllRecords().
+void setIOBackend(
+    IOBackend backend // in: backend to use from now on
+);
+
+//--------------------------------------------------
+// Returns the active backend. On first use it is taken from
+// the FRSS_IO_BACKEND environment variable ("stream" or
+// "batched"), defaulting to batched.
+IOBackend getIOBackend();
+
+//--------------------------------------------------
+// Reads every complete fixed-length record in 'file' into
+// 'records'. The batched backend pulls the whole file in one
+// read; if that fails it falls back to the per-record path.
+// Leaves the stream in a good state. Returns false if the file
+// is not open.
+template <typename Record>
+bool readAllRecords(
+    std::fstream &file,           // in: open store file
+    std::vector<Record> &records  // out: every record in file order
+)
+{
+    SpanScope span("recordIO::readAllRecords");
+    records.clear();
+    if (!file.is_open())
+        return false;
+
+    countIO(IO_FULL_SCANS);
+    file.clear();
+    if (getIOBackend() == IO_BACKEND_BATCHED)
+    {
+        file.seekg(0, std::ios::end);
+        std::streamoff size = file.tellg();
+        countIO(IO_SEEKS);
+        if (size >= 0)
+        {
+            records.resize(static_cast<size_t>(size) / sizeof(Record));
+            file.seekg(0);
+            countIO(IO_SEEKS);
+            if (records.empty() ||
+                file.read(reinterpret_cast<char *>(records.data()),
+                          records.size() * sizeof(Record)))
+            {
+                file.clear();
+                countIO(IO_RECORDS_READ, records.size());
+                countIO(IO_BYTES_READ, records.size() * sizeof(Record));
+                return true;
+            }
+        }
+        // Batched read failed part-way, redo it record by record
+        records.clear();
+        file.clear();
+    }
+
+    file.seekg(0);
+    countIO(IO_SEEKS);
+    Record rec;
+    // Loop goal: Read each fixed-length record until end of file
+    while (file.read(reinterpret_cast<char *>(&rec), sizeof(Record)))
+    {
+        records.push_back(rec);
+    }
+    file.clear();
+    countIO(IO_RECORDS_READ, records.size());
+    countIO(IO_BYTES_READ, records.size() * sizeof(Record));
+    return true;
+}
+
+//--------------------------------------------------
+// Writes 'records' to the current put position of 'out'.
+// The batched backend issues a single write for the whole
+// vector. Returns true if the stream is still good.
+template <typename Record>
+bool writeAllRecords(
+    std::ostream &out,                  // in: destination stream
+    const std::vector<Record> &records  // in: records to write
+)
+{
+    SpanScope span("recordIO::writeAllRecords");
+    if (records.empty())
+        return out.good();
+
+    countIO(IO_BYTES_WRITTEN, records.size() * sizeof(Record));
+    if (getIOBackend() == IO_BACKEND_BATCHED)
+    {
+        out.write(reinterpret_cast<const char *>(records.data()),
+                  records.size() * sizeof(Record));
+        return out.good();
+    }
+
+    // Loop goal: Write each record with its own call
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        out.write(reinterpret_cast<const char *>(&records[i]), sizeof(Record));
+    }
+    return out.good();
+}
+
+//--------------------------------------------------
+// Flushes a store's pending writes to the file.
+inline void flushRecords(
+    std::ostream &out // in: store stream to flush
+)
+{
+    SpanScope span("recordIO::flush");
+    countIO(IO_FLUSHES);
+    out.flush();
+}
+
+//--------------------------------------------------
+// Reads the record in 'slot' (0 for the first record). Returns
+// false if the file holds no such record.
+template <typename Record>
+bool readRecordAt(
+    std::istream &in, // in:  store stream
+    size_t slot,      // in:  record number
+    Record &record    // out: record read
+)
+{
+    in.seekg(static_cast<std::streamoff>(slot * sizeof(Record)));
+    countIO(IO_SEEKS);
+    if (!in.read(reinterpret_cast<char *>(&record), sizeof(Record)))
+        return false;
+    countIO(IO_RECORDS_READ);
+    countIO(IO_BYTES_READ, sizeof(Record));
+    return true;
+}
+
+//--------------------------------------------------
+// Overwrites (or, one past the end, appends) the record in
+// 'slot'. Does not flush. Returns true if the stream is still
+// good.
+template <typename Record>
+bool writeRecordAt(
+    std::ostream &out,    // in: store stream
+    size_t slot,          // in: record number
+    const Record &record  // in: record to write
+)
+{
+    out.seekp(static_cast<std::streamoff>(slot * sizeof(Record)));
+    countIO(IO_SEEKS);
+    out.write(reinterpret_cast<const char *>(&record), sizeof(Record));
+    countIO(IO_BYTES_WRITTEN, sizeof(Record));
+    return out.good();
+}
+
+#endif // RECORD_IO_H
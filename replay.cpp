@@ -0,0 +1,411 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Replays an operation trace recorded by ferry_system against
+//   the data files in the current directory, without the menus,
+//   and reports the latency distribution of each operation.
+//************************************************************
+// USAGE:
+// - Record: FRSS_TRACE=session.trace ./ferry_system
+// - Replay: ./ferry_replay session.trace [--paced] [--speed X]
+//                          [--spans FILE]
+//   By default operations run back to back. --paced keeps the
+//   recorded gaps between operations; --speed X divides them by X.
+//   --spans writes a Chrome trace-event file of the replay, one
+//   "replay::" span per operation around the calls it made.
+// - The trace is replayed against whatever data is on disk, so
+//   restore (or regenerate with setup_demo --seed ...) the data
+//   the session started from for a faithful replay.
+// - Reports count, failures, mean, p50, p90, p99 and max per
+//   operation, next to the p50 measured while recording.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial headless trace replay.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Operations call the libfrss core directly; it never
+//            prints, so cout is no longer redirected while timing.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Added --spans for a Chrome trace-event file.
+//************************************************************
+
+#include "operationTrace.h"
+#include "sailing.h"
+#include "sailingFileIO.h"
+#include "vehicle.h"
+#include "vehicleFileIO.h"
+#include "reservation.h"
+#include "revenueReport.h"
+#include "spanTrace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+//--------------------------------------------------
+// Latencies of one operation across the replay
+struct OperationStats
+{
+    vector<double> samples;  // replayed latencies, microseconds
+    vector<double> recorded; // latencies in the trace, microseconds
+    size_t failed;           // replays that reported failure
+
+    OperationStats() : failed(0) {}
+};
+
+//--------------------------------------------------
+// Function: argAt
+//--------------------------------------------------
+// Returns argument i of an event, or "" if it was not recorded.
+static string argAt(const TraceEvent &e, size_t i)
+{
+    return i < e.args.size() ? e.args[i] : string();
+}
+
+static int intArg(const TraceEvent &e, size_t i)
+{
+    return atoi(argAt(e, i).c_str());
+}
+
+static float floatArg(const TraceEvent &e, size_t i)
+{
+    return static_cast<float>(atof(argAt(e, i).c_str()));
+}
+
+static bool boolArg(const TraceEvent &e, size_t i)
+{
+    return argAt(e, i) == "1";
+}
+
+//--------------------------------------------------
+// Function: percentile
+//--------------------------------------------------
+// Returns the p-th percentile (0-100) of sorted samples.
+static double percentile(const vector<double> &sorted, double p)
+{
+    if (sorted.empty())
+        return 0.0;
+    size_t rank = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[min(rank, sorted.size() - 1)];
+}
+
+//--------------------------------------------------
+// Function: replaySailingOperation
+//--------------------------------------------------
+// Runs a sailing operation. Sets 'known' to false if the name is
+// not a sailing operation; returns false if the operation failed.
+static bool replaySailingOperation(const TraceEvent &e, bool &known)
+{
+    known = true;
+    const string &op = e.operation;
+    if (op == "addSailing")
+    {
+        return Sailing::addSailing(argAt(e, 0).c_str(), argAt(e, 1), intArg(e, 2), intArg(e, 3));
+    }
+    if (op == "editSailing")
+    {
+        return Sailing::applyEdit(argAt(e, 0).c_str(), argAt(e, 1).c_str(), argAt(e, 2),
+                                  intArg(e, 3), intArg(e, 4));
+    }
+    if (op == "deleteSailing")
+    {
+        return Sailing::deleteWithReservations(argAt(e, 0).c_str()) >= 0;
+    }
+    if (op == "displayReport")
+    {
+        SailingCursor cursor(REPORT_PAGE_SIZE);
+        ostringstream page;
+        bool found = cursor.seekPage(static_cast<size_t>(intArg(e, 0)));
+        Sailing::writeReportPage(page, cursor);
+        return found;
+    }
+    if (op == "queryReport")
+    {
+        SailingQuery q;
+        q.terminal = argAt(e, 0);
+        q.day = intArg(e, 1);
+        q.fromHour = intArg(e, 2);
+        q.toHour = intArg(e, 3);
+        q.vessel = argAt(e, 4);
+        q.order = static_cast<SailingOrder>(intArg(e, 5));
+        q.descending = boolArg(e, 6);
+        q.limit = static_cast<size_t>(atol(argAt(e, 7).c_str()));
+        ostringstream results;
+        Sailing::writeQueryResults(results, q);
+        return true;
+    }
+    known = false;
+    return false;
+}
+
+//--------------------------------------------------
+// Function: replayVehicleOperation
+//--------------------------------------------------
+// Runs a vehicle operation, opening the vehicle store for it the
+// way the menus do.
+static bool replayVehicleOperation(const TraceEvent &e, bool &known)
+{
+    known = true;
+    const string &op = e.operation;
+    if (op == "addVehicle")
+    {
+        Vehicle v;
+        return v.addVehicle(argAt(e, 0).c_str(), argAt(e, 1).c_str(), floatArg(e, 2), floatArg(e, 3));
+    }
+    if (op == "renameVehicle")
+    {
+        return renameVehicle(argAt(e, 0), argAt(e, 1));
+    }
+    if (op == "saveVehicle")
+    {
+        return updateVehicle(argAt(e, 0), argAt(e, 1), floatArg(e, 2), floatArg(e, 3));
+    }
+    if (op == "deleteVehicle")
+    {
+        return deleteVehicle(argAt(e, 0));
+    }
+
+    FileIOforVehicle vehicleIO;
+    if (op == "getManifest")
+    {
+        bool opened = vehicleIO.open();
+        vehicleIO.getManifest(argAt(e, 0));
+        vehicleIO.close();
+        return opened;
+    }
+    if (op == "findByPhone")
+    {
+        if (!vehicleIO.open())
+            return false;
+        vehicleIO.getPlatesForPhone(argAt(e, 0));
+        vehicleIO.getUpcomingForPhone(argAt(e, 0));
+        vehicleIO.close();
+        return true;
+    }
+    if (op == "searchPlates")
+    {
+        if (!vehicleIO.open())
+            return false;
+        size_t limit = static_cast<size_t>(atol(argAt(e, 1).c_str()));
+        vehicleIO.findPlatesWithPrefix(argAt(e, 0), limit);
+        vehicleIO.findSimilarPlates(argAt(e, 0), intArg(e, 2), limit);
+        vehicleIO.close();
+        return true;
+    }
+    known = false;
+    return false;
+}
+
+//--------------------------------------------------
+// Function: replayReservationOperation
+//--------------------------------------------------
+// Runs a reservation or check-in operation.
+static bool replayReservationOperation(const TraceEvent &e, bool &known)
+{
+    known = true;
+    const string &op = e.operation;
+    if (op == "addReservation")
+    {
+        return addReservation(argAt(e, 0), argAt(e, 1), argAt(e, 2), boolArg(e, 3),
+                              floatArg(e, 4), floatArg(e, 5));
+    }
+    if (op == "addGroupReservation")
+    {
+        vector<GroupVehicle> members;
+        // Loop goal: Rebuild each member from its four arguments
+        for (size_t i = 1; i + 3 < e.args.size(); i += 4)
+        {
+            GroupVehicle member;
+            member.licensePlate = argAt(e, i);
+            member.isSpecial = boolArg(e, i + 1);
+            member.height = floatArg(e, i + 2);
+            member.length = floatArg(e, i + 3);
+            members.push_back(member);
+        }
+        return addGroupReservation(argAt(e, 0), members);
+    }
+    if (op == "cancelReservation")
+    {
+        return cancelReservation(argAt(e, 0), argAt(e, 1));
+    }
+    if (op == "checkIn")
+    {
+        return checkIn(argAt(e, 0), argAt(e, 1), boolArg(e, 2), floatArg(e, 3), floatArg(e, 4)) >= 0.0f;
+    }
+    if (op == "checkInBatch")
+    {
+        vector<string> plates(e.args.begin() + min<size_t>(1, e.args.size()), e.args.end());
+        vector<CheckInResult> results = checkInBatch(argAt(e, 0), plates);
+        // Loop goal: Fail the batch if any vehicle was not checked in
+        for (const auto &r : results)
+        {
+            if (!r.error.empty())
+                return false;
+        }
+        return true;
+    }
+    if (op == "revenueReport")
+    {
+        buildRevenueReport();
+        return true;
+    }
+    known = false;
+    return false;
+}
+
+//--------------------------------------------------
+// Function: printStats
+//--------------------------------------------------
+// Prints one line of the latency table.
+static void printStats(const string &name, OperationStats &stats)
+{
+    sort(stats.samples.begin(), stats.samples.end());
+    sort(stats.recorded.begin(), stats.recorded.end());
+    double total = 0.0;
+    // Loop goal: Sum the samples for the mean
+    for (double sample : stats.samples)
+    {
+        total += sample;
+    }
+    double mean = stats.samples.empty() ? 0.0 : total / stats.samples.size();
+    cout << "  " << left << setw(20) << name << right
+         << setw(7) << stats.samples.size()
+         << setw(7) << stats.failed
+         << fixed << setprecision(1)
+         << setw(11) << mean
+         << setw(11) << percentile(stats.samples, 50)
+         << setw(11) << percentile(stats.samples, 90)
+         << setw(11) << percentile(stats.samples, 99)
+         << setw(11) << (stats.samples.empty() ? 0.0 : stats.samples.back())
+         << setw(13) << percentile(stats.recorded, 50) << "\n";
+}
+
+int main(int argc, char *argv[])
+{
+    string tracePath;
+    string spansPath;
+    bool paced = false;
+    double speed = 1.0;
+    // Loop goal: Read the trace path and options
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--paced") == 0)
+        {
+            paced = true;
+        }
+        else if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc)
+        {
+            paced = true;
+            speed = atof(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--spans") == 0 && i + 1 < argc)
+        {
+            spansPath = argv[++i];
+        }
+        else if (argv[i][0] != '-' && tracePath.empty())
+        {
+            tracePath = argv[i];
+        }
+        else
+        {
+            tracePath.clear();
+            break;
+        }
+    }
+    if (tracePath.empty() || speed <= 0.0)
+    {
+        cerr << "Usage: " << argv[0] << " TRACE [--paced] [--speed X] [--spans FILE]\n";
+        return 1;
+    }
+
+    vector<TraceEvent> events;
+    if (!readTrace(tracePath, events))
+    {
+        cerr << "Unable to read trace file " << tracePath << ".\n";
+        return 1;
+    }
+
+    if (!spansPath.empty() && !startSpanTrace(spansPath))
+    {
+        cerr << "Unable to write span file " << spansPath << ".\n";
+        return 1;
+    }
+    Sailing::initialize();
+    ::initialize();
+
+    typedef chrono::steady_clock Clock;
+    map<string, OperationStats> stats;
+    size_t unknown = 0;
+    Clock::time_point replayStart = Clock::now();
+    // Loop goal: Replay each operation in trace order, timing it alone
+    for (const auto &e : events)
+    {
+        if (paced)
+        {
+            this_thread::sleep_until(replayStart + chrono::microseconds(
+                static_cast<long long>(e.startMicros / speed)));
+        }
+
+        bool known = false;
+        Clock::time_point start = Clock::now();
+        bool ok = replaySailingOperation(e, known);
+        if (!known)
+            ok = replayVehicleOperation(e, known);
+        if (!known)
+            ok = replayReservationOperation(e, known);
+        Clock::time_point stop = Clock::now();
+        if (known && spanTracing())
+        {
+            string span = "replay::" + e.operation;
+            writeSpan(span.c_str(), start, stop, !ok);
+        }
+
+        if (!known)
+        {
+            ++unknown;
+            continue;
+        }
+        OperationStats &s = stats[e.operation];
+        s.samples.push_back(chrono::duration<double, micro>(stop - start).count());
+        s.recorded.push_back(static_cast<double>(e.durationMicros));
+        if (!ok)
+            ++s.failed;
+    }
+    double wallSeconds = chrono::duration<double>(Clock::now() - replayStart).count();
+
+    ::shutdown();
+    Sailing::shutdown();
+    stopSpanTrace();
+
+    cout << "Replayed " << events.size() - unknown << " operations from " << tracePath
+         << " in " << fixed << setprecision(3) << wallSeconds << " s ("
+         << setprecision(0) << (wallSeconds > 0.0 ? (events.size() - unknown) / wallSeconds : 0.0)
+         << " ops/s)";
+    if (paced)
+        cout << ", paced at " << setprecision(2) << speed << "x";
+    cout << "\n";
+    if (unknown > 0)
+        cout << "Skipped " << unknown << " operations this replay does not know.\n";
+    cout << "Latency in microseconds:\n";
+    cout << "  " << left << setw(20) << "operation" << right
+         << setw(7) << "count" << setw(7) << "failed"
+         << setw(11) << "mean" << setw(11) << "p50" << setw(11) << "p90"
+         << setw(11) << "p99" << setw(11) << "max" << setw(13) << "recorded p50" << "\n";
+    // Loop goal: Print each operation's distribution, by name
+    for (auto &entry : stats)
+    {
+        printStats(entry.first, entry.second);
+    }
+    return 0;
+}
@@ -16,10 +16,23 @@
 // specification.
 // Rev. 2 - 2025/08/05 - Danny Choi
 //        - Fully debugged final release version.
+// Rev. 3 - 2026/10/18 - Group 19
+//        - Added checkInBatch() and addGroupReservation().
+//        - moveReservations() moves in one pass and transfers capacity.
+//        - deleteAllOnSailing() deletes in one pass.
+//        - Reservation changes keep the sailing counters current;
+//          added cancelReservation().
+//        - Reservation operations record latency statistics.
+//        - cancelReservation() refunds the fare of an onboard
+//          vehicle.
+//        - deleteAllOnSailing() clears the sailing's revenue too.
+//        - checkIn() prices from the registered vehicle and fails
+//          if the reservation can't be saved.
 //************************************************************
 
 
 #include "reservation.h"
+#include "latencyStats.h"
 #include "reservationFileIO.h"
 #include "sailing.h"
 #include "sailingFileIO.h"
@@ -27,6 +40,8 @@
 #include "vehicleFileIO.h"
 #include <iostream>
 #include <cstring>
+#include <set>
+#include <unordered_map>
 
 //--------------------------------------------------
 // Function: initialize
@@ -49,13 +64,82 @@ void shutdown()
     close();
 }
 
+//--------------------------------------------------
+// Function: vehicleFootprint
+//--------------------------------------------------
+// Works out the length (taken from LRL) and height (taken from
+// HRL) a vehicle uses, excluding spacing. Special vehicles use
+// their own dimensions, regular vehicles the standard ones.
+static void vehicleFootprint(bool isSpecial, float height, float length,
+                             float &lengthNeeded, float &heightNeeded)
+{
+    lengthNeeded = isSpecial ? length : REGULAR_LENGTH;
+    heightNeeded = isSpecial ? height : REGULAR_HEIGHT;
+}
+
+//--------------------------------------------------
+// Function: makeRecord
+//--------------------------------------------------
+// Builds a zeroed, not-yet-onboard reservation record.
+static ReservationRecord makeRecord(const std::string &sailingID,
+                                    const std::string &licensePlate)
+{
+    ReservationRecord record;
+    std::memset(&record, 0, sizeof(ReservationRecord)); // Clear all bytes in the struct
+
+    std::strncpy(record.sailingID, sailingID.c_str(), SAILING_ID_MAX - 1);
+    record.sailingID[SAILING_ID_MAX - 1] = '\0'; // Ensure null termination
+    
+    std::strncpy(record.licensePlate, licensePlate.c_str(), LICENSE_PLATE_MAX - 1);
+    record.licensePlate[LICENSE_PLATE_MAX - 1] = '\0'; // Ensure null termination
+
+    record.onboard = false;
+    return record;
+}
+
+//--------------------------------------------------
+// Function: lookupVehicles
+//--------------------------------------------------
+// Loads the registered vehicles for the given plates in one pass
+// over the vehicle file. Plates not on file are left out.
+static std::unordered_map<std::string, Vehicle> lookupVehicles(
+    const std::vector<std::string> &plates)
+{
+    std::unordered_map<std::string, Vehicle> vehicles;
+    FileIOforVehicle vehicleIO;
+    if (vehicleIO.open())
+    {
+        vehicles = vehicleIO.getVehicles(plates);
+        vehicleIO.close();
+    }
+    return vehicles;
+}
+
+//--------------------------------------------------
+// Function: registeredFare
+//--------------------------------------------------
+// Returns the fare of a vehicle from its registered dimensions,
+// or the regular fare if it is not on file. Reads the one record
+// through the vehicle store's plate index.
+static float registeredFare(const std::string &licensePlate)
+{
+    FileIOforVehicle vehicleIO;
+    Vehicle vehicle;
+    std::string phone;
+    bool found = vehicleIO.open() && vehicleIO.getVehicleWithData(licensePlate, vehicle, phone);
+    vehicleIO.close();
+    if (!found)
+        return calculateFare(false, 0.0f, 0.0f);
+    return calculateFare(vehicle.isSpecial(), vehicle.getLength(), vehicle.getHeight());
+}
+
 //--------------------------------------------------
 // Function: addReservation
 //--------------------------------------------------
-// Creates a new reservation record, zeroes its memory, fills
-// it with user input, and writes it to file. Assumes reservation
-// uniqueness is managed at a higher level or via overwrite logic
-// in the file layer.
+// Reserves deck space on the sailing, then creates a new
+// reservation record and writes it to file. Space is only taken
+// if both the length and height fit, and the sailing's counters
+// are saved with it. Fails if the vehicle is already booked.
 bool addReservation(const std::string &sailingID,
                     const std::string &licensePlate,
                     const std::string &phone,
@@ -63,65 +147,101 @@ bool addReservation(const std::string &sailingID,
                     float height,
                     float length)
 {
+    static LatencyStat &stat = latencyStat("reservation::addReservation");
+    LatencyTimer timer(stat);
     // Mark unused parameters to suppress compiler warnings
- 
+    (void)phone;
+
+    // A second booking of the same vehicle would be counted twice
+    if (exists(licensePlate, sailingID))
+        return timer.result(false);
     
     // Get the sailing to update its capacity
     Sailing sailing = Sailing::getSailingFromIO(sailingID.c_str());
     
-    // Check how many vehicles are already on this sailing to determine spacing
-    std::vector<ReservationRecord> existingReservations = getAllOnSailing(sailingID);
-    const float VEHICLE_SPACING = 0.5f; // 0.5 meter spacing between vehicles
-    
     // Only add spacing if there are already vehicles on the sailing
-    float spacingNeeded = existingReservations.empty() ? 0.0f : VEHICLE_SPACING;
-    
-    bool capacityUpdated = false;
-    if (isSpecial) {
-        // Special vehicles use:
-        // - Length + spacing from LRL (Low Remaining Length)
-        // - Height from HRL (High Remaining Length)
-        float lengthNeeded = length + spacingNeeded;
-        float heightNeeded = height;
-        
-        bool lrlUpdated = sailing.lrlUpdate(lengthNeeded);
-        bool hrlUpdated = sailing.hrlUpdate(heightNeeded);
-        capacityUpdated = lrlUpdated && hrlUpdated;
-    } else {
-        // Regular vehicles always use standard dimensions:
-        // - 7.0m length + spacing from LRL (Low Remaining Length)  
-        // - 2.0m height from HRL (High Remaining Length)
-        const float REGULAR_LENGTH = 7.0f;
-        const float REGULAR_HEIGHT = 2.0f;
-        
-        float lengthNeeded = REGULAR_LENGTH + spacingNeeded;
-        float heightNeeded = REGULAR_HEIGHT;
-        
-        bool lrlUpdated = sailing.lrlUpdate(lengthNeeded);
-        bool hrlUpdated = sailing.hrlUpdate(heightNeeded);
-        capacityUpdated = lrlUpdated && hrlUpdated;
-    }
+    float spacingNeeded = sailing.getReservedCount() == 0 ? 0.0f : VEHICLE_SPACING;
     
+    float lengthNeeded, heightNeeded;
+    vehicleFootprint(isSpecial, height, length, lengthNeeded, heightNeeded);
+
+    // The counters are saved with the capacity by reserveCapacity()
+    sailing.adjustCounters(1, isSpecial ? 1 : 0, 0, 0.0f);
+
     // If we couldn't update capacity (sailing is full), return false
-    if (!capacityUpdated) {
-        return false;
+    if (!sailing.reserveCapacity(lengthNeeded + spacingNeeded, heightNeeded)) {
+        return timer.result(false);
     }
 
-    // Save the updated sailing capacity to file
-    sailingFileIO::saveSailing(sailing);
+    if (!saveReservation(makeRecord(sailingID, licensePlate)))
+    {
+        sailing.adjustCounters(-1, isSpecial ? -1 : 0, 0, 0.0f);
+        sailing.reserveCapacity(-(lengthNeeded + spacingNeeded), -heightNeeded);
+        return timer.result(false);
+    }
+    return true;
+}
 
-    ReservationRecord record;
-    std::memset(&record, 0, sizeof(ReservationRecord)); // Clear all bytes in the struct
+//--------------------------------------------------
+// Function: addGroupReservation
+//--------------------------------------------------
+// Books a whole group in one step: checks every plate, sums the
+// length, height and spacing the group needs, takes that space
+// from the sailing with a single update and writes all records
+// with one saveReservations() call. If the records cannot be
+// written the space is given back.
+bool addGroupReservation(const std::string &sailingID,
+                         const std::vector<GroupVehicle> &vehicles)
+{
+    static LatencyStat &stat = latencyStat("reservation::addGroupReservation");
+    LatencyTimer timer(stat);
+    if (vehicles.empty())
+        return timer.result(false);
 
-    std::strncpy(record.sailingID, sailingID.c_str(), SAILING_ID_MAX - 1);
-    record.sailingID[SAILING_ID_MAX - 1] = '\0'; // Ensure null termination
-    
-    std::strncpy(record.licensePlate, licensePlate.c_str(), LICENSE_PLATE_MAX - 1);
-    record.licensePlate[LICENSE_PLATE_MAX - 1] = '\0'; // Ensure null termination
+    std::set<std::string> plates;
+    std::vector<ReservationRecord> records;
+    float totalLength = 0.0f;
+    float totalHeight = 0.0f;
+    int specials = 0;
 
-    record.onboard = false;
+    // Loop goal: Reject the group on any duplicate or existing booking,
+    // otherwise add up each vehicle's footprint
+    for (const auto &vehicle : vehicles)
+    {
+        if (!plates.insert(vehicle.licensePlate).second ||
+            exists(vehicle.licensePlate, sailingID))
+            return timer.result(false);
 
-    return saveReservation(record);
+        float lengthNeeded, heightNeeded;
+        vehicleFootprint(vehicle.isSpecial, vehicle.height, vehicle.length,
+                         lengthNeeded, heightNeeded);
+        totalLength += lengthNeeded;
+        totalHeight += heightNeeded;
+        if (vehicle.isSpecial)
+            ++specials;
+        records.push_back(makeRecord(sailingID, vehicle.licensePlate));
+    }
+
+    Sailing sailing = Sailing::getSailingFromIO(sailingID.c_str());
+
+    // Every vehicle needs spacing except the first one onto an empty sailing
+    size_t spacedVehicles = vehicles.size();
+    if (sailing.getReservedCount() == 0)
+        --spacedVehicles;
+    totalLength += VEHICLE_SPACING * spacedVehicles;
+
+    int groupSize = static_cast<int>(vehicles.size());
+    sailing.adjustCounters(groupSize, specials, 0, 0.0f);
+    if (!sailing.reserveCapacity(totalLength, totalHeight))
+        return timer.result(false);
+
+    if (!saveReservations(records))
+    {
+        sailing.adjustCounters(-groupSize, -specials, 0, 0.0f);
+        sailing.reserveCapacity(-totalLength, -totalHeight);
+        return timer.result(false);
+    }
+    return true;
 }
 
 //--------------------------------------------------
@@ -133,6 +253,8 @@ bool addReservation(const std::string &sailingID,
 bool checkedIn(const std::string &sailingID,
                const std::string &licensePlate)
 {
+    static LatencyStat &stat = latencyStat("reservation::checkedIn");
+    LatencyTimer timer(stat);
     ReservationRecord record;
 
     // Attempt to locate record in file
@@ -153,20 +275,129 @@ bool checkedIn(const std::string &sailingID,
 // Function: checkIn
 //--------------------------------------------------
 // If a reservation exists, performs check-in (onboard=true),
-// saves it, and calculates fare based on input vehicle info.
-// Returns fare, or -1.0f if reservation doesn't exist.
+// saves it, and calculates the fare from the registered vehicle,
+// so the revenue added here is what cancelling, moving and the
+// store audit take it to be. The first check-in of a vehicle
+// also adds it to the sailing's onboard count and revenue.
+// Returns fare, or -1.0f if reservation doesn't exist or can't
+// be saved.
 float checkIn(const std::string &sailingID,
               const std::string &licensePlate,
-              bool isSpecial,
-              float height,
-              float length)
+              bool /*isSpecial*/,
+              float /*height*/,
+              float /*length*/)
 {
-    if (!exists(licensePlate, sailingID))
-        return -1.0f;
+    static LatencyStat &stat = latencyStat("reservation::checkIn");
+    LatencyTimer timer(stat);
+    ReservationRecord record;
+    if (!getReservation(licensePlate, sailingID, record))
+        return timer.failWith(-1.0f);
+
+    float fare = registeredFare(licensePlate);
 
-    checkedIn(sailingID, licensePlate);
+    if (!record.onboard)
+    {
+        record.onboard = true;
+        if (!saveReservation(record))
+            return timer.failWith(-1.0f);
+        if (sailingFileIO::exists(sailingID.c_str()))
+        {
+            Sailing sailing = Sailing::getSailingFromIO(sailingID.c_str());
+            sailing.adjustCounters(0, 0, 1, fare);
+            sailingFileIO::saveSailing(sailing);
+        }
+    }
 
-    return calculateFare(isSpecial, length, height);
+    return fare;
+}
+
+//--------------------------------------------------
+// Function: checkInBatch
+//--------------------------------------------------
+// Resolves every plate through the reservation index, flips the
+// onboard flags of the valid ones in a single saveReservations()
+// call, then prices them from one pass over the vehicle file.
+std::vector<CheckInResult> checkInBatch(const std::string &sailingID,
+                                        const std::vector<std::string> &licensePlates)
+{
+    static LatencyStat &stat = latencyStat("reservation::checkInBatch");
+    LatencyTimer timer(stat);
+    std::vector<CheckInResult> results(licensePlates.size());
+    std::vector<ReservationRecord> updates;
+    std::vector<size_t> accepted; // result slots of plates being checked in
+    std::set<std::string> seen;
+
+    // Loop goal: Validate each plate and collect the records to mark onboard
+    for (size_t i = 0; i < licensePlates.size(); ++i)
+    {
+        CheckInResult &result = results[i];
+        result.licensePlate = licensePlates[i];
+        result.fare = -1.0f;
+
+        ReservationRecord record;
+        if (!getReservation(licensePlates[i], sailingID, record))
+        {
+            result.error = "No reservation on this sailing";
+        }
+        else if (record.onboard || !seen.insert(licensePlates[i]).second)
+        {
+            result.error = "Already checked in";
+        }
+        else
+        {
+            record.onboard = true;
+            updates.push_back(record);
+            accepted.push_back(i);
+        }
+    }
+
+    if (updates.empty())
+        return results;
+
+    if (!saveReservations(updates))
+    {
+        // Loop goal: Report the failed write against every accepted plate
+        for (size_t i : accepted)
+        {
+            results[i].error = "Could not save check-in";
+        }
+        timer.fail();
+        return results;
+    }
+
+    std::vector<std::string> plates;
+    // Loop goal: Gather the plates that need pricing
+    for (size_t i : accepted)
+    {
+        plates.push_back(licensePlates[i]);
+    }
+
+    std::unordered_map<std::string, Vehicle> vehicles = lookupVehicles(plates);
+
+    float collected = 0.0f;
+    // Loop goal: Price each checked-in vehicle from its dimensions
+    for (size_t i : accepted)
+    {
+        std::unordered_map<std::string, Vehicle>::const_iterator v =
+            vehicles.find(licensePlates[i]);
+        if (v != vehicles.end())
+            results[i].fare = calculateFare(v->second.isSpecial(),
+                                            v->second.getLength(),
+                                            v->second.getHeight());
+        else
+            results[i].fare = calculateFare(false, 0.0f, 0.0f);
+        collected += results[i].fare;
+    }
+
+    // One sailing update for the whole lane
+    if (sailingFileIO::exists(sailingID.c_str()))
+    {
+        Sailing sailing = Sailing::getSailingFromIO(sailingID.c_str());
+        sailing.adjustCounters(0, 0, static_cast<int>(accepted.size()), collected);
+        sailingFileIO::saveSailing(sailing);
+    }
+
+    return results;
 }
 
 //--------------------------------------------------
@@ -178,11 +409,6 @@ float checkIn(const std::string &sailingID,
 // - Low long special vehicles: $2/m
 float calculateFare(bool isSpecial, float length, float height)
 {
-    const float REGULAR_FARE = 14.00f;
-    const float HEIGHT_THRESHOLD = 2.00f;
-    const float OVER_HEIGHT_RATE = 3.00f;
-    const float STANDARD_RATE = 2.00f;
-
     if (!isSpecial)
         return REGULAR_FARE;
 
@@ -195,25 +421,91 @@ float calculateFare(bool isSpecial, float length, float height)
     return 0.0f; // Fallback for unexpected input
 }
 
+//--------------------------------------------------
+// Function: cancelReservation
+//--------------------------------------------------
+// Deletes one reservation, then gives its deck space back to the
+// sailing and takes it off the sailing's counters in one save.
+// If the vehicle was onboard its fare is taken off the revenue,
+// priced as checkInBatch() charged it.
+bool cancelReservation(const std::string &sailingID,
+                       const std::string &licensePlate)
+{
+    static LatencyStat &stat = latencyStat("reservation::cancelReservation");
+    LatencyTimer timer(stat);
+    ReservationRecord record;
+    if (!getReservation(licensePlate, sailingID, record))
+        return timer.result(false);
+
+    std::unordered_map<std::string, Vehicle> vehicles =
+        lookupVehicles(std::vector<std::string>(1, licensePlate));
+
+    if (!deleteReservation(licensePlate, sailingID))
+        return timer.result(false);
+
+    if (!sailingFileIO::exists(sailingID.c_str()))
+        return true;
+
+    bool isSpecial = false;
+    float lengthNeeded, heightNeeded;
+    float fare;
+    std::unordered_map<std::string, Vehicle>::const_iterator v = vehicles.find(licensePlate);
+    if (v != vehicles.end())
+    {
+        isSpecial = v->second.isSpecial();
+        vehicleFootprint(isSpecial, v->second.getHeight(), v->second.getLength(),
+                         lengthNeeded, heightNeeded);
+        fare = calculateFare(isSpecial, v->second.getLength(), v->second.getHeight());
+    }
+    else
+    {
+        vehicleFootprint(false, 0.0f, 0.0f, lengthNeeded, heightNeeded);
+        fare = calculateFare(false, 0.0f, 0.0f);
+    }
+
+    Sailing sailing = Sailing::getSailingFromIO(sailingID.c_str());
+    // The last vehicle left on the sailing is the one loaded without spacing
+    float spacingReleased = sailing.getReservedCount() > 1 ? VEHICLE_SPACING : 0.0f;
+    sailing.adjustCounters(-1, isSpecial ? -1 : 0, record.onboard ? -1 : 0,
+                           record.onboard ? -fare : 0.0f);
+    sailing.reserveCapacity(-(lengthNeeded + spacingReleased), -heightNeeded);
+    return true;
+}
+
 //--------------------------------------------------
 // Function: deleteAllOnSailing
 //--------------------------------------------------
-// Iterates through all reservations matching sailingID and deletes them.
-// GOAL: count how many reservations were deleted.
-// Step: one record at a time from getAllOnSailing result.
+// Deletes every reservation on the sailing with one pass over the
+// file through deleteReservationsWhere(). If the sailing is still
+// on file its deck space is restored and its counters and revenue
+// cleared, so it stays consistent even if a caller's following
+// delete of the sailing fails.
+// Returns the number of reservations deleted, or -1 if the
+// reservation file could not be rewritten.
 int deleteAllOnSailing(const std::string &sailingID)
 {
-    int count = 0;
-    std::vector<ReservationRecord> records = getAllOnSailing(sailingID);
+    static LatencyStat &stat = latencyStat("reservation::deleteAllOnSailing");
+    LatencyTimer timer(stat);
+    if (getAllOnSailing(sailingID).empty())
+        return 0;
 
-    // Loop goal: Delete each reservation record for the specified sailing
-    for (const auto &rec : records)
+    int count = deleteReservationsWhere([&](const ReservationRecord &rec)
     {
-        // Delete one record at a time by license plate + sailing ID
-        if (deleteReservation(std::string(rec.licensePlate), sailingID))
-        {
-            ++count;
-        }
+        return std::strncmp(rec.sailingID, sailingID.c_str(), SAILING_ID_MAX) == 0;
+    });
+    if (count < 0)
+        return timer.failWith(-1);
+    if (count == 0)
+        return 0;
+
+    if (sailingFileIO::exists(sailingID.c_str()))
+    {
+        Sailing sailing = Sailing::getSailingFromIO(sailingID.c_str());
+        sailing.adjustCounters(-sailing.getReservedCount(), -sailing.getSpecialCount(),
+                               -sailing.getOnboardCount(), -sailing.getRevenue());
+        // releases are capped at the sailing's limits, so this empties the deck
+        sailing.reserveCapacity(-static_cast<float>(sailing.getLCLL()),
+                                -static_cast<float>(sailing.getHCLL()));
     }
 
     return count;
@@ -223,26 +515,88 @@ int deleteAllOnSailing(const std::string &sailingID)
 // Function: moveReservations
 //--------------------------------------------------
 // Transfers all reservations from one sailing ID to another by:
-// - reading matching reservations
-// - modifying the sailingID field
-// - re-saving them with the updated ID
-// GOAL: perform in-place update of file contents for sailing migration.
+// - pricing the space the moved vehicles need on the destination
+//   (their footprints plus spacing) from one vehicle-file pass
+// - taking that space from the destination, failing if it won't fit
+// - relabelling every record in place with moveAllOnSailing()
+// - giving the same vehicles' space back to the source
+// Returns the number moved, or -1 if nothing could be moved.
 int moveReservations(const std::string &fromSailingID,
                      const std::string &toSailingID)
 {
-    int count = 0;
+    static LatencyStat &stat = latencyStat("reservation::moveReservations");
+    LatencyTimer timer(stat);
     std::vector<ReservationRecord> records = getAllOnSailing(fromSailingID);
+    if (records.empty() || fromSailingID == toSailingID)
+        return 0;
 
-    // Loop goal: Move each reservation from one sailing to another by updating sailingID
-    for (auto &rec : records)
+    std::vector<std::string> plates;
+    // Loop goal: Collect the plates whose dimensions are needed
+    for (const auto &rec : records)
     {
-        std::strncpy(rec.sailingID, toSailingID.c_str(), SAILING_ID_MAX);
+        plates.push_back(std::string(rec.licensePlate));
+    }
+
+    std::unordered_map<std::string, Vehicle> vehicles = lookupVehicles(plates);
 
-        if (saveReservation(rec))
+    float totalLength = 0.0f;
+    float totalHeight = 0.0f;
+    int specials = 0;
+    int onboard = 0;
+    float revenue = 0.0f;
+    // Loop goal: Add up the footprint, counts and collected fares of
+    // every vehicle being moved, treating unregistered vehicles as regular
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        std::unordered_map<std::string, Vehicle>::const_iterator v = vehicles.find(plates[i]);
+        bool isSpecial = v != vehicles.end() && v->second.isSpecial();
+        float height = v != vehicles.end() ? v->second.getHeight() : 0.0f;
+        float length = v != vehicles.end() ? v->second.getLength() : 0.0f;
+
+        float lengthNeeded, heightNeeded;
+        vehicleFootprint(isSpecial, height, length, lengthNeeded, heightNeeded);
+        totalLength += lengthNeeded;
+        totalHeight += heightNeeded;
+        if (isSpecial)
+            ++specials;
+        if (records[i].onboard)
         {
-            ++count;
+            ++onboard;
+            revenue += calculateFare(isSpecial, length, height);
         }
     }
 
-    return count;
-}
\ No newline at end of file
+    if (!sailingFileIO::exists(toSailingID.c_str()))
+        return timer.failWith(-1);
+    Sailing target = Sailing::getSailingFromIO(toSailingID.c_str());
+
+    // On the source the first vehicle loaded had no spacing; on the
+    // destination every moved vehicle needs it unless it is empty
+    float spacingReleased = VEHICLE_SPACING * (records.size() - 1);
+    size_t spacedOnTarget = records.size();
+    if (target.getReservedCount() == 0)
+        --spacedOnTarget;
+    float spacingTaken = VEHICLE_SPACING * spacedOnTarget;
+
+    int count = static_cast<int>(records.size());
+    target.adjustCounters(count, specials, onboard, revenue);
+    if (!target.reserveCapacity(totalLength + spacingTaken, totalHeight))
+        return timer.failWith(-1);
+
+    int moved = moveAllOnSailing(fromSailingID, toSailingID);
+    if (moved < 0)
+    {
+        target.adjustCounters(-count, -specials, -onboard, -revenue);
+        target.reserveCapacity(-(totalLength + spacingTaken), -totalHeight);
+        return timer.failWith(-1);
+    }
+
+    if (sailingFileIO::exists(fromSailingID.c_str()))
+    {
+        Sailing source = Sailing::getSailingFromIO(fromSailingID.c_str());
+        source.adjustCounters(-count, -specials, -onboard, -revenue);
+        source.reserveCapacity(-(totalLength + spacingReleased), -totalHeight);
+    }
+
+    return moved;
+}
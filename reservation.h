@@ -21,6 +21,15 @@
 // implementation.
 // Rev. 3 - 2025/08/05 - Danny Choi
 //          - Fully debugged final release version.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - Added checkInBatch() for checking in whole lanes.
+//          - Added addGroupReservation() for fleet bookings.
+//          - moveReservations() now transfers sailing capacity.
+//          - Added cancelReservation(); reservation changes keep
+//            the sailing's counters current.
+//          - Fare rules moved to shared constants.
+//          - Deck space rules moved to shared constants.
+//          - checkIn() prices from the registered vehicle.
 //************************************************************
 // in: Represents input parameter
 // out: Represents output parameter
@@ -31,12 +40,25 @@
 #define RESERVATION_H
 
 #include <string>
+#include <vector>
 
 const int LICENSE_PLATE_MAX = 12; // Max characters for license plate (including 
 // null terminator)
 const int SAILING_ID_MAX = 10;     // Max characters for sailing ID (including 
 // null terminator)
 
+// Fare rules, shared by calculateFare() and the revenue report's kernels
+const float REGULAR_FARE = 14.00f;     // flat fare for regular vehicles
+const float HEIGHT_THRESHOLD = 2.00f;  // special vehicles above this are over-height
+const float OVER_HEIGHT_RATE = 3.00f;  // $/m for over-height special vehicles
+const float STANDARD_RATE = 2.00f;     // $/m for other special vehicles
+
+// Deck space rules, shared by single and group bookings and the
+// workload generator
+const float VEHICLE_SPACING = 0.5f; // 0.5 meter spacing between vehicles
+const float REGULAR_LENGTH = 7.0f;  // regular vehicles always use 7.0m length
+const float REGULAR_HEIGHT = 2.0f;  // and 2.0m height
+
 //--------------------------------------------------
 // Minimal type used for interface clarity only.
 // This struct represents a reservation as seen at the interface level.
@@ -48,6 +70,25 @@ struct ReservationData
     bool onboard;             // True if checked-in, false otherwise
 };
 
+//--------------------------------------------------
+// Outcome of checking in one vehicle as part of a batch.
+struct CheckInResult
+{
+    std::string licensePlate; // Vehicle license plate
+    float fare;               // Fare charged, or -1.0 if not checked in
+    std::string error;        // Empty on success, otherwise the reason
+};
+
+//--------------------------------------------------
+// One vehicle in a group (fleet) booking.
+struct GroupVehicle
+{
+    std::string licensePlate; // Vehicle license plate
+    bool isSpecial;           // True if special vehicle
+    float height;             // Height (if special), else 0
+    float length;             // Length (if special), else 0
+};
+
 //--------------------------------------------------
 // Initializes the reservation subsystem.
 void initialize();
@@ -68,6 +109,18 @@ bool addReservation(
     float length                     // in: length (if special), else 0
 );
 
+//--------------------------------------------------
+// Reserves every vehicle in a group on one sailing, or none.
+// The length, height and 0.5m spacing for the whole group are
+// taken from the sailing in one update and all reservations are
+// written in one batch.
+// Returns false (and books nothing) if the group is empty, a
+// plate is repeated or already booked, or the group won't fit.
+bool addGroupReservation(
+    const std::string &sailingID,            // in: sailing to reserve on
+    const std::vector<GroupVehicle> &vehicles // in: vehicles in the group
+);
+
 //--------------------------------------------------
 // Marks an existing reservation as checked in.
 // Returns true if successful.
@@ -77,14 +130,29 @@ bool checkedIn(
 );
 
 //--------------------------------------------------
-// Performs check-in logic and returns calculated fare.
-// Returns -1.0 if reservation does not exist.
+// Performs check-in logic and returns calculated fare. The fare
+// comes from the registered vehicle (regular if it is not on
+// file), as checkInBatch() and cancelReservation() price it; the
+// dimensions passed in are kept for existing callers and traces.
+// Returns -1.0 if reservation does not exist or can't be saved.
 float checkIn(
     const std::string &sailingID,    // in: sailing ID
     const std::string &licensePlate, // in: vehicle's license plate
-    bool isSpecial,                  // in: true if special vehicle
-    float height,                    // in: height if special (m)
-    float length                     // in: length if special (m)
+    bool isSpecial,                  // in: true if special vehicle (not used for the fare)
+    float height,                    // in: height if special (m) (not used for the fare)
+    float length                     // in: length if special (m) (not used for the fare)
+);
+
+//--------------------------------------------------
+// Checks in a lane of vehicles on one sailing. Plates are
+// resolved through the reservation index, vehicle dimensions are
+// loaded in one pass, and all onboard flags are saved in one
+// grouped write. Vehicles missing from the vehicle file are
+// charged the regular fare.
+// Returns one result per plate, in the order given.
+std::vector<CheckInResult> checkInBatch(
+    const std::string &sailingID,                 // in: sailing ID
+    const std::vector<std::string> &licensePlates // in: plates in the lane
 );
 
 //--------------------------------------------------
@@ -97,15 +165,31 @@ float calculateFare(
 );
 
 //--------------------------------------------------
-// Deletes all reservations for the given sailing.
-// Returns the number of reservations deleted.
+// Cancels one reservation and gives its deck space back to the
+// sailing, updating the sailing's counters in the same save. An
+// onboard vehicle's fare is taken off the sailing's revenue.
+// Returns false if the reservation does not exist.
+bool cancelReservation(
+    const std::string &sailingID,   // in: sailing ID
+    const std::string &licensePlate // in: vehicle's license plate
+);
+
+//--------------------------------------------------
+// Deletes all reservations for the given sailing. If the sailing
+// still exists its space is restored and its counters and revenue
+// cleared.
+// Returns the number of reservations deleted, or -1 if the
+// reservation file could not be rewritten.
 int deleteAllOnSailing(
     const std::string &sailingID // in: sailing ID
 );
 
 //--------------------------------------------------
-// Moves all reservations from one sailing to another.
-// Returns number of reservations successfully moved.
+// Moves all reservations from one sailing to another in one pass
+// and transfers their deck space from the source sailing to the
+// destination. Nothing is moved if the destination is missing,
+// lacks space, or already holds one of the vehicles.
+// Returns number of reservations moved, or -1 on failure.
 int moveReservations(
     const std::string &fromSailingID, // in: source sailing ID
     const std::string &toSailingID    // in: destination sailing ID
@@ -18,14 +18,33 @@
 // specification.
 // Rev. 2 - 2025/08/05 - Danny Choi
 //          - Fully debugged final release version.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Store operations record latency statistics.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - Index rebuilds and flushes are span trace spans.
+//          - Slot reads and writes, seeks and reopens are counted
+//            in the storage I/O counters.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - rebuildIndex() builds its keys on the thread pool.
+// Rev. 6 - 2026/10/18 - Group 19
+//          - moveAllOnSailing() writes and flushes every slot before
+//            touching the index, and puts the old sailing ID back
+//            if a write fails.
 //************************************************************
 
 
 #include "reservationFileIO.h"
+#include "latencyStats.h"
 #include "reservation.h"
+#include "ioStats.h"
+#include "recordIO.h"
+#include "spanTrace.h"
+#include "threadPool.h"
 #include <fstream>
 #include <iostream>
 #include <vector>
+#include <map>
+#include <algorithm>
 #include <cstring>
 #include <unistd.h> // for ftruncate, fileno
 #define TRUNCATE ftruncate
@@ -41,14 +60,111 @@ static std::fstream reservationFile;
 // truncation)
 static std::string filePath;
 
+//--------------------------------------------------
+// In-memory index from "plate/sailingID" to the record's slot
+// (position in the file divided by the record size). Built in
+// open() and rebuilt whenever the file is rewritten, so point
+// lookups and updates never scan the file.
+static std::map<std::string, long> slotIndex;
+
+//--------------------------------------------------
+// Slots of every record on each sailing, in file order
+static std::map<std::string, std::vector<long>> sailingSlots;
+
+//--------------------------------------------------
+// Number of records currently in the file
+static long recordCount = 0;
+
+//--------------------------------------------------
+// Records keyed per thread pool task when the index is rebuilt
+static const size_t INDEX_CHUNK = 16384;
+
+//--------------------------------------------------
+// Builds the sailing index key, matching strncmp() semantics.
+static std::string sailingKey(const char *sailingID)
+{
+    return std::string(sailingID, strnlen(sailingID, SAILING_ID_MAX));
+}
+
+//--------------------------------------------------
+// Builds the index key from a fixed-length field pair. Matches
+// the strncmp() comparison used on the fields: at most 'max'
+// characters, stopping at the first null.
+static std::string indexKey(const char *plate, const char *sailingID)
+{
+    std::string key(plate, strnlen(plate, LICENSE_PLATE_MAX));
+    key += '/';
+    key.append(sailingID, strnlen(sailingID, SAILING_ID_MAX));
+    return key;
+}
+
+//--------------------------------------------------
+// Builds the index key from caller-supplied strings.
+static std::string indexKey(const std::string &licensePlate, const std::string &sailingID)
+{
+    return indexKey(licensePlate.c_str(), sailingID.c_str());
+}
+
+//--------------------------------------------------
+// Rebuilds the slot index from the full set of records.
+static void rebuildIndex(const std::vector<ReservationRecord> &all)
+{
+    SpanScope span("reservationFileIO::rebuildIndex");
+    slotIndex.clear();
+    sailingSlots.clear();
+
+    // The keys are built on the thread pool, each chunk into its own
+    // slots; the maps are then filled in file order on this thread
+    std::vector<std::string> keys(all.size());
+    std::vector<std::string> sailings(all.size());
+    parallelFor(all.size(), INDEX_CHUNK, [&](size_t begin, size_t end)
+    {
+        // Loop goal: Build both keys of each record in the chunk
+        for (size_t i = begin; i < end; ++i)
+        {
+            keys[i] = indexKey(all[i].licensePlate, all[i].sailingID);
+            sailings[i] = sailingKey(all[i].sailingID);
+        }
+    });
+
+    // Loop goal: Record the slot of each reservation; later
+    // duplicates keep the first slot, as the old scans did
+    for (size_t i = 0; i < all.size(); ++i)
+    {
+        slotIndex.insert(std::make_pair(std::move(keys[i]), static_cast<long>(i)));
+        sailingSlots[sailings[i]].push_back(static_cast<long>(i));
+    }
+    recordCount = static_cast<long>(all.size());
+}
+
+//--------------------------------------------------
+// Reads the record stored in the given slot.
+static bool readSlot(long slot, ReservationRecord &record)
+{
+    reservationFile.clear();
+    return readRecordAt(reservationFile, static_cast<size_t>(slot), record);
+}
+
+//--------------------------------------------------
+// Overwrites the record stored in the given slot (no flush).
+static void writeSlot(long slot, const ReservationRecord &record)
+{
+    reservationFile.clear();
+    writeRecordAt(reservationFile, static_cast<size_t>(slot), record);
+}
+
 //--------------------------------------------------
 // Opens the binary reservation file for read/write access.
-// If file does not exist, it is created. Returns true on success.
+// If file does not exist, it is created. Loads the slot index.
+// Returns true on success.
 bool open(const std::string &filename)
 {
+    static LatencyStat &stat = latencyStat("reservationFileIO::open");
+    LatencyTimer timer(stat);
     filePath = filename;
 
     reservationFile.open(filePath, std::ios::in | std::ios::out | std::ios::binary);
+    countIO(IO_REOPENS);
 
     if (!reservationFile.is_open())
     {
@@ -58,81 +174,126 @@ bool open(const std::string &filename)
         reservationFile.open(filePath, std::ios::in | std::ios::out | std::ios::binary);
     }
 
-    return reservationFile.is_open();
+    std::vector<ReservationRecord> all;
+    readAllRecords(reservationFile, all);
+    rebuildIndex(all);
+
+    return timer.result(reservationFile.is_open());
 }
 
 //--------------------------------------------------
 // Closes the currently open reservation file if open.
 void close()
 {
+    static LatencyStat &stat = latencyStat("reservationFileIO::close");
+    LatencyTimer timer(stat);
     if (reservationFile.is_open())
         reservationFile.close();
+    slotIndex.clear();
+    sailingSlots.clear();
+    recordCount = 0;
 }
 
 //--------------------------------------------------
 // Saves a reservation record to file. If a matching record
-// exists, it is overwritten. Otherwise, the record is appended.
-// Returns true if successful.
+// exists, it is overwritten in its slot. Otherwise, the record
+// is appended. Returns true if successful.
 bool saveReservation(const ReservationRecord &record)
 {
+    static LatencyStat &stat = latencyStat("reservationFileIO::saveReservation");
+    LatencyTimer timer(stat);
     if (!reservationFile.is_open())
-        return false;
+        return timer.result(false);
 
-    ReservationRecord existing;
-    long pos = 0;
-    reservationFile.clear();
-    reservationFile.seekg(0);
+    std::string key = indexKey(record.licensePlate, record.sailingID);
+    std::map<std::string, long>::const_iterator found = slotIndex.find(key);
+    if (found != slotIndex.end())
+    {
+        writeSlot(found->second, record);
+        flushRecords(reservationFile); // Ensure data is written to disk
+        return timer.result(reservationFile.good()); // confirm successful write
+    }
+
+    // Append to end if not found
+    writeSlot(recordCount, record);
+    flushRecords(reservationFile); // Ensure data is written to disk
+    if (!reservationFile.good())
+        return timer.result(false);
+    sailingSlots[sailingKey(record.sailingID)].push_back(recordCount);
+    slotIndex[key] = recordCount++;
+    return true; // confirm successful append
+}
+
+//--------------------------------------------------
+// Saves a batch of reservation records with a single flush.
+// Existing records are overwritten in their slots; new ones are
+// appended together in one write. Returns true if successful.
+bool saveReservations(const std::vector<ReservationRecord> &records)
+{
+    static LatencyStat &stat = latencyStat("reservationFileIO::saveReservations");
+    LatencyTimer timer(stat);
+    if (!reservationFile.is_open())
+        return timer.result(false);
+
+    std::vector<ReservationRecord> appended;
+    long firstNewSlot = recordCount;
 
-    // Search for existing matching record
-    // Loop goal: Read through all reservation records to find matching license 
-    // plate and sailing ID
-    while (reservationFile.read(reinterpret_cast<char *>(&existing), sizeof(ReservationRecord)))
+    // Loop goal: Update records already on file in place and queue
+    // the rest for one appended write
+    for (const auto &record : records)
     {
-        if (std::strncmp(existing.licensePlate, record.licensePlate, LICENSE_PLATE_MAX) == 0 &&
-            std::strncmp(existing.sailingID, record.sailingID, SAILING_ID_MAX) == 0)
+        std::string key = indexKey(record.licensePlate, record.sailingID);
+        std::map<std::string, long>::const_iterator found = slotIndex.find(key);
+        if (found == slotIndex.end())
+        {
+            long slot = firstNewSlot + static_cast<long>(appended.size());
+            slotIndex[key] = slot;
+            sailingSlots[sailingKey(record.sailingID)].push_back(slot);
+            appended.push_back(record);
+        }
+        else if (found->second >= firstNewSlot)
         {
-            reservationFile.seekp(pos);
-            reservationFile.write(reinterpret_cast<const char *>(&record), sizeof(ReservationRecord));
-            reservationFile.flush(); // Ensure data is written to disk
-            return reservationFile.good(); // confirm successful write
+            // Repeated within this batch, last copy wins
+            appended[found->second - firstNewSlot] = record;
+        }
+        else
+        {
+            writeSlot(found->second, record);
         }
-        pos = reservationFile.tellg();
     }
 
-    // Append to end if not found
-    reservationFile.clear();
-    reservationFile.seekp(0, std::ios::end);
-    reservationFile.write(reinterpret_cast<const char *>(&record), sizeof(ReservationRecord));
-    reservationFile.flush(); // Ensure data is written to disk
-    return reservationFile.good(); // confirm successful append
+    if (!appended.empty())
+    {
+        reservationFile.clear();
+        reservationFile.seekp(firstNewSlot * static_cast<long>(sizeof(ReservationRecord)));
+        countIO(IO_SEEKS);
+        writeAllRecords(reservationFile, appended);
+        recordCount += static_cast<long>(appended.size());
+    }
+    flushRecords(reservationFile); // One flush for the whole batch
+    return timer.result(reservationFile.good());
 }
 
 //--------------------------------------------------
 // Retrieves a reservation record matching license plate 
-// and sailing ID.
+// and sailing ID through the slot index.
 // Loads the result into 'record'. Returns true if found, 
 // false otherwise.
 bool getReservation(const std::string &licensePlate,
                     const std::string &sailingID,
                     ReservationRecord &record)
 {
+    static LatencyStat &stat = latencyStat("reservationFileIO::getReservation");
+    LatencyTimer timer(stat);
     if (!reservationFile.is_open())
         return false;
 
-    reservationFile.clear();
-    reservationFile.seekg(0);
-
-    // Loop goal: Search through all reservation records to find specific license plate and sailing ID
-    while (reservationFile.read(reinterpret_cast<char *>(&record), sizeof(ReservationRecord)))
-    {
-        if (std::strncmp(record.licensePlate, licensePlate.c_str(), LICENSE_PLATE_MAX) == 0 &&
-            std::strncmp(record.sailingID, sailingID.c_str(), SAILING_ID_MAX) == 0)
-        {
-            return true;
-        }
-    }
+    std::map<std::string, long>::const_iterator found =
+        slotIndex.find(indexKey(licensePlate, sailingID));
+    if (found == slotIndex.end())
+        return false;
 
-    return false;
+    return readSlot(found->second, record);
 }
 
 //--------------------------------------------------
@@ -140,46 +301,82 @@ bool getReservation(const std::string &licensePlate,
 // and sailing ID exists in the file.
 bool exists(const std::string &licensePlate, const std::string &sailingID)
 {
-    ReservationRecord dummy;
-    return getReservation(licensePlate, sailingID, dummy);
+    static LatencyStat &stat = latencyStat("reservationFileIO::exists");
+    LatencyTimer timer(stat);
+    if (!reservationFile.is_open())
+        return false;
+    return slotIndex.count(indexKey(licensePlate, sailingID)) > 0;
 }
 
 //--------------------------------------------------
-// Deletes a reservation record by rewriting all other records
-// to a truncated file. Returns true if deletion succeeded.
+// Deletes a reservation record. Returns false straight away if
+// the index has no such record; otherwise removes it with one
+// rewrite through deleteReservationsWhere().
 bool deleteReservation(const std::string &licensePlate, const std::string &sailingID)
 {
+    static LatencyStat &stat = latencyStat("reservationFileIO::deleteReservation");
+    LatencyTimer timer(stat);
     if (!reservationFile.is_open())
-        return false;
+        return timer.result(false);
+
+    if (slotIndex.count(indexKey(licensePlate, sailingID)) == 0)
+        return timer.result(false);
+
+    return timer.result(deleteReservationsWhere([&](const ReservationRecord &rec)
+    {
+        return std::strncmp(rec.licensePlate, licensePlate.c_str(), LICENSE_PLATE_MAX) == 0 &&
+               std::strncmp(rec.sailingID, sailingID.c_str(), SAILING_ID_MAX) == 0;
+    }) > 0);
+}
+
+//--------------------------------------------------
+// Deletes every record matching the predicate in one pass: the
+// file is read once, filtered, and rewritten to a truncated file
+// once (skipped if nothing matched). Returns the number deleted,
+// or -1 if the file is not open.
+int deleteReservationsWhere(const std::function<bool(const ReservationRecord &)> &match)
+{
+    static LatencyStat &stat = latencyStat("reservationFileIO::deleteReservationsWhere");
+    LatencyTimer timer(stat);
+    if (!reservationFile.is_open())
+        return timer.failWith(-1);
 
     std::vector<ReservationRecord> all;
-    ReservationRecord rec;
-    reservationFile.clear();
-    reservationFile.seekg(0);
+    readAllRecords(reservationFile, all);
 
-    // Loop goal: Read all records and keep only those that don't match the deletion criteria
-    while (reservationFile.read(reinterpret_cast<char *>(&rec), sizeof(ReservationRecord)))
+    // Keep only the records that don't match the deletion criteria
+    std::vector<ReservationRecord> kept = parallelFilter(all, [&](const ReservationRecord &rec)
     {
-        if (!(std::strncmp(rec.licensePlate, licensePlate.c_str(), LICENSE_PLATE_MAX) == 0 &&
-              std::strncmp(rec.sailingID, sailingID.c_str(), SAILING_ID_MAX) == 0))
-        {
-            all.push_back(rec);
-        }
-    }
+        return !match(rec);
+    });
+
+    int removed = static_cast<int>(all.size() - kept.size());
+    if (removed == 0)
+        return 0;
 
     // Rewrite all remaining records
     reservationFile.close(); // close before overwriting
     std::ofstream truncFile(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
-    // Loop goal: Write all remaining records back to the file after deletion
-    for (const auto &r : all)
-    {
-        truncFile.write(reinterpret_cast<const char *>(&r), sizeof(ReservationRecord));
-    }
+    writeAllRecords(truncFile, kept);
     truncFile.close();
 
     // Reopen the file for further I/O
     reservationFile.open(filePath, std::ios::in | std::ios::out | std::ios::binary);
-    return true;
+    countIO(IO_REOPENS);
+    rebuildIndex(kept);
+    return removed;
+}
+
+//--------------------------------------------------
+// Reads the whole reservation file in one call.
+std::vector<ReservationRecord> getAllReservations()
+{
+    static LatencyStat &stat = latencyStat("reservationFileIO::getAllReservations");
+    LatencyTimer timer(stat);
+    std::vector<ReservationRecord> all;
+    if (reservationFile.is_open())
+        readAllRecords(reservationFile, all);
+    return all;
 }
 
 //--------------------------------------------------
@@ -187,23 +384,100 @@ bool deleteReservation(const std::string &licensePlate, const std::string &saili
 // Returns them in a vector.
 std::vector<ReservationRecord> getAllOnSailing(const std::string &sailingID)
 {
+    static LatencyStat &stat = latencyStat("reservationFileIO::getAllOnSailing");
+    LatencyTimer timer(stat);
     std::vector<ReservationRecord> results;
     if (!reservationFile.is_open())
         return results;
 
+    std::map<std::string, std::vector<long>>::const_iterator found =
+        sailingSlots.find(sailingKey(sailingID.c_str()));
+    if (found == sailingSlots.end())
+        return results;
+
+    results.reserve(found->second.size());
     ReservationRecord rec;
-    reservationFile.clear();
-    reservationFile.seekg(0);
+    // Loop goal: Read each indexed slot belonging to this sailing
+    for (long slot : found->second)
+    {
+        if (readSlot(slot, rec))
+            results.push_back(rec);
+    }
+
+    return results;
+}
+
+//--------------------------------------------------
+// Rewrites the sailing ID of every record on the source sailing
+// in its own slot and moves the index entries across, with one
+// flush. Returns the number of records moved, or -1 (changing
+// nothing) if a vehicle is already booked on the destination or
+// a write fails.
+int moveAllOnSailing(const std::string &fromSailingID, const std::string &toSailingID)
+{
+    static LatencyStat &stat = latencyStat("reservationFileIO::moveAllOnSailing");
+    LatencyTimer timer(stat);
+    if (!reservationFile.is_open())
+        return timer.failWith(-1);
+
+    std::string fromKey = sailingKey(fromSailingID.c_str());
+    std::string toKey = sailingKey(toSailingID.c_str());
+    std::map<std::string, std::vector<long>>::iterator source = sailingSlots.find(fromKey);
+    if (source == sailingSlots.end() || source->second.empty() || fromKey == toKey)
+        return 0;
+
+    std::vector<ReservationRecord> records;
+    records.reserve(source->second.size());
+    ReservationRecord rec;
+    // Loop goal: Load every record on the source and check none clash with the destination
+    for (long slot : source->second)
+    {
+        if (!readSlot(slot, rec) || slotIndex.count(indexKey(rec.licensePlate, toKey.c_str())))
+            return timer.failWith(-1);
+        records.push_back(rec);
+    }
 
-    while (reservationFile.read(reinterpret_cast<char *>(&rec), sizeof(ReservationRecord)))
+    std::vector<ReservationRecord> moved(records);
+    bool written = true;
+    // Loop goal: Relabel each record in its own slot, stopping at a failed write
+    for (size_t i = 0; i < moved.size() && written; ++i)
     {
-        if (std::strncmp(rec.sailingID, sailingID.c_str(), SAILING_ID_MAX) == 0)
+        std::strncpy(moved[i].sailingID, toSailingID.c_str(), SAILING_ID_MAX - 1);
+        moved[i].sailingID[SAILING_ID_MAX - 1] = '\0';
+        writeSlot(source->second[i], moved[i]);
+        written = reservationFile.good();
+    }
+    if (written)
+    {
+        flushRecords(reservationFile); // One flush for the whole move
+        written = reservationFile.good();
+    }
+    if (!written)
+    {
+        // Any slot may have reached the disk: put the source ID back in all of them
+        // Loop goal: Rewrite each record as it was
+        for (size_t i = 0; i < records.size(); ++i)
         {
-            results.push_back(rec);
+            writeSlot(source->second[i], records[i]);
         }
+        flushRecords(reservationFile);
+        return timer.failWith(-1);
     }
 
-    return results;
+    // Every slot is on disk: re-key the index
+    std::vector<long> slots;
+    slots.swap(source->second);
+    sailingSlots.erase(fromKey);
+    std::vector<long> &destination = sailingSlots[toKey];
+    // Loop goal: Move each record's index entries to the destination
+    for (size_t i = 0; i < moved.size(); ++i)
+    {
+        slotIndex.erase(indexKey(records[i].licensePlate, records[i].sailingID));
+        slotIndex[indexKey(moved[i].licensePlate, moved[i].sailingID)] = slots[i];
+        destination.push_back(slots[i]);
+    }
+    std::sort(destination.begin(), destination.end());
+    return static_cast<int>(moved.size());
 }
 
 //--------------------------------------------------
@@ -211,21 +485,31 @@ std::vector<ReservationRecord> getAllOnSailing(const std::string &sailingID)
 // Returns them in a vector.
 std::vector<ReservationRecord> getAllWithVehicle(const std::string &licensePlate)
 {
+    static LatencyStat &stat = latencyStat("reservationFileIO::getAllWithVehicle");
+    LatencyTimer timer(stat);
     std::vector<ReservationRecord> results;
     if (!reservationFile.is_open())
         return results;
 
-    ReservationRecord rec;
-    reservationFile.clear();
-    reservationFile.seekg(0);
+    // Every key for this plate sorts from "plate/" up to "plate0"
+    // ('0' follows '/'), so its reservations form one index range
+    std::string prefix = indexKey(licensePlate, "");
+    std::vector<long> slots;
+    // Loop goal: Collect the slot of every key starting with the prefix
+    for (std::map<std::string, long>::const_iterator it = slotIndex.lower_bound(prefix);
+         it != slotIndex.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+    {
+        slots.push_back(it->second);
+    }
+    std::sort(slots.begin(), slots.end());
 
-    while (reservationFile.read(reinterpret_cast<char *>(&rec), sizeof(ReservationRecord)))
+    ReservationRecord rec;
+    // Loop goal: Read each matching slot, in file order
+    for (long slot : slots)
     {
-        if (std::strncmp(rec.licensePlate, licensePlate.c_str(), LICENSE_PLATE_MAX) == 0)
-        {
+        if (readSlot(slot, rec))
             results.push_back(rec);
-        }
     }
 
     return results;
-}
\ No newline at end of file
+}
@@ -21,6 +21,17 @@
 //          - Finalized format and synced with .cpp logic.
 // Rev. 3 - 2025/08/05 - Danny Choi
 //          - Fully debugged final release version.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - Slot index for point lookups, saveReservations().
+//          - Per-sailing slot index, moveAllOnSailing().
+//          - deleteReservationsWhere() bulk delete.
+//          - getAllReservations() for reports.
+//          - getAllWithVehicle() reads a slot index range.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - Documented that deleteReservationsWhere() predicates run
+//            concurrently.
+// Rev. 6 - 2026/10/18 - Group 19
+//          - moveAllOnSailing() changes nothing when a write fails.
 //************************************************************
 // in:  Represents input parameter
 // out: Represents output parameter
@@ -32,6 +43,7 @@
 #include <string>
 #include <vector>
 #include <fstream>
+#include <functional>
 #include "reservation.h"
 
 //--------------------------------------------------
@@ -49,7 +61,8 @@ struct ReservationRecord
 };
 
 //--------------------------------------------------
-// Opens the reservation data file for binary read/write access.
+// Opens the reservation data file for binary read/write access
+// and loads the in-memory (plate, sailing) slot index.
 // Returns true on success, false if file could not be opened.
 bool open(
     const std::string &filename // in: path to binary file
@@ -68,6 +81,15 @@ bool saveReservation(
     const ReservationRecord &record // in: reservation to save
 );
 
+//--------------------------------------------------
+// Saves or updates a batch of reservation records with a single
+// flush. Existing records are rewritten in place; new ones are
+// appended together in one write.
+// Returns true if successful.
+bool saveReservations(
+    const std::vector<ReservationRecord> &records // in: reservations to save
+);
+
 //--------------------------------------------------
 // Retrieves a reservation record by vehicle and sailing ID.
 // Populates the provided record struct.
@@ -95,14 +117,44 @@ bool deleteReservation(
 );
 
 //--------------------------------------------------
-// Retrieves all reservations for a given sailing ID.
+// Deletes every reservation for which match(record) is true with
+// a single read and a single rewrite of the file.
+// Returns the number deleted, or -1 if the file is not open.
+// match() is called from thread pool workers at the same time,
+// in no set order: it must only read the record and its
+// captures, never write shared state or call the stores.
+int deleteReservationsWhere(
+    const std::function<bool(const ReservationRecord &)> &match // in: records to delete
+);
+
+//--------------------------------------------------
+// Retrieves all reservations for a given sailing ID through the
+// per-sailing slot index, in file order.
 // Returns a vector of matching ReservationRecords.
 std::vector<ReservationRecord> getAllOnSailing(
     const std::string &sailingID // in: sailing ID
 );
 
 //--------------------------------------------------
-// Retrieves all reservations associated with a license plate.
+// Moves every reservation on one sailing to another by rewriting
+// each record's sailing ID in place, with a single flush.
+// Returns the number moved, or -1 if a vehicle on the source
+// is already booked on the destination or a write fails
+// (nothing is changed: failed writes are undone on disk before
+// the index is touched).
+int moveAllOnSailing(
+    const std::string &fromSailingID, // in: source sailing ID
+    const std::string &toSailingID    // in: destination sailing ID
+);
+
+//--------------------------------------------------
+// Retrieves every reservation on file with a single read, in
+// file order. Used by whole-store reports.
+std::vector<ReservationRecord> getAllReservations();
+
+//--------------------------------------------------
+// Retrieves all reservations associated with a license plate
+// through a prefix range of the slot index, in file order.
 // Returns a vector of matching ReservationRecords.
 std::vector<ReservationRecord> getAllWithVehicle(
     const std::string &licensePlate // in: vehicle ID
@@ -0,0 +1,273 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the revenue report and the fare kernels declared
+//   in revenueReport.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial SoA revenue report and SIMD fare kernel.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - buildRevenueReport() records latency statistics.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Added computeFareCentsPortable().
+//************************************************************
+
+#include "revenueReport.h"
+#include "latencyStats.h"
+#include "reservation.h"
+#include "reservationFileIO.h"
+#include "sailingFileIO.h"
+#include "threadPool.h"
+#include "vehicle.h"
+#include "vehicleFileIO.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FRSS_AVX2_KERNEL 1
+#include <immintrin.h>
+#endif
+
+//--------------------------------------------------
+// Columns are priced and joined in chunks of this many rows
+const size_t REVENUE_CHUNK = 65536;
+
+// Group index of reservations whose sailing is not in the table yet
+const uint32_t NO_GROUP = 0xFFFFFFFFu;
+
+int32_t fareToCents(float fare)
+{
+    return static_cast<int32_t>(std::nearbyint(static_cast<double>(fare) * 100.0));
+}
+
+//--------------------------------------------------
+// Function: computeFareCentsScalar
+//--------------------------------------------------
+// Portable kernel. The same rules as calculateFare(), written as
+// selects instead of an if/else chain.
+static void computeFareCentsScalar(const float *special, const float *length,
+                                   const float *height, int32_t *cents,
+                                   size_t begin, size_t end)
+{
+    // Loop goal: Price each vehicle in [begin, end)
+    for (size_t i = begin; i < end; ++i)
+    {
+        float overFare = length[i] * OVER_HEIGHT_RATE;
+        float standardFare = height[i] <= HEIGHT_THRESHOLD ? length[i] * STANDARD_RATE : 0.0f;
+        float specialFare = height[i] > HEIGHT_THRESHOLD ? overFare : standardFare;
+        float fare = special[i] != 0.0f ? specialFare : REGULAR_FARE;
+        cents[i] = fareToCents(fare);
+    }
+}
+
+#ifdef FRSS_AVX2_KERNEL
+//--------------------------------------------------
+// Function: computeFareCentsAVX2
+//--------------------------------------------------
+// Prices eight vehicles per step with compare masks and blends.
+// Cents are rounded in double precision with the default
+// round-to-nearest-even mode, exactly like fareToCents().
+// Returns the number of vehicles priced (a multiple of eight).
+__attribute__((target("avx2")))
+static size_t computeFareCentsAVX2(const float *special, const float *length,
+                                   const float *height, int32_t *cents, size_t count)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 regularFare = _mm256_set1_ps(REGULAR_FARE);
+    const __m256 threshold = _mm256_set1_ps(HEIGHT_THRESHOLD);
+    const __m256 overRate = _mm256_set1_ps(OVER_HEIGHT_RATE);
+    const __m256 standardRate = _mm256_set1_ps(STANDARD_RATE);
+    const __m256d hundred = _mm256_set1_pd(100.0);
+
+    size_t i = 0;
+    // Loop goal: Price each full block of eight vehicles
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 isSpecial = _mm256_cmp_ps(_mm256_loadu_ps(special + i), zero, _CMP_NEQ_UQ);
+        __m256 len = _mm256_loadu_ps(length + i);
+        __m256 ht = _mm256_loadu_ps(height + i);
+
+        __m256 over = _mm256_cmp_ps(ht, threshold, _CMP_GT_OQ);
+        __m256 within = _mm256_cmp_ps(ht, threshold, _CMP_LE_OQ);
+        __m256 overFare = _mm256_mul_ps(len, overRate);
+        __m256 standardFare = _mm256_and_ps(_mm256_mul_ps(len, standardRate), within);
+        __m256 specialFare = _mm256_blendv_ps(standardFare, overFare, over);
+        __m256 fare = _mm256_blendv_ps(regularFare, specialFare, isSpecial);
+
+        __m256d low = _mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(fare)), hundred);
+        __m256d high = _mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(fare, 1)), hundred);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(cents + i), _mm256_cvtpd_epi32(low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(cents + i + 4), _mm256_cvtpd_epi32(high));
+    }
+    return i;
+}
+#endif
+
+void computeFareCentsPortable(const float *special, const float *length, const float *height,
+                              int32_t *cents, size_t count)
+{
+    computeFareCentsScalar(special, length, height, cents, 0, count);
+}
+
+bool fareKernelUsesAVX2()
+{
+#ifdef FRSS_AVX2_KERNEL
+    // FRSS_FARE_KERNEL=scalar forces the portable kernel
+    static const bool useAVX2 = __builtin_cpu_supports("avx2") &&
+        !(std::getenv("FRSS_FARE_KERNEL") != NULL &&
+          std::strcmp(std::getenv("FRSS_FARE_KERNEL"), "scalar") == 0);
+    return useAVX2;
+#else
+    return false;
+#endif
+}
+
+void computeFareCents(const float *special, const float *length, const float *height,
+                      int32_t *cents, size_t count)
+{
+    size_t done = 0;
+#ifdef FRSS_AVX2_KERNEL
+    if (fareKernelUsesAVX2())
+        done = computeFareCentsAVX2(special, length, height, cents, count);
+#endif
+    // the scalar kernel handles the tail (or everything without AVX2)
+    computeFareCentsScalar(special, length, height, cents, done, count);
+}
+
+//--------------------------------------------------
+// Function: boundedString
+//--------------------------------------------------
+// Builds a string from a fixed-length, possibly unterminated field.
+static std::string boundedString(const char *field, size_t size)
+{
+    return std::string(field, strnlen(field, size));
+}
+
+RevenueReport buildRevenueReport()
+{
+    static LatencyStat &stat = latencyStat("revenueReport::buildRevenueReport");
+    LatencyTimer timer(stat);
+    RevenueReport report;
+    report.totalCents = 0;
+
+    // One group per sailing, in report table order
+    std::unordered_map<std::string, uint32_t> groupOf;
+    const std::vector<SailingReportRow> &rows = sailingFileIO::reportRows();
+    // Loop goal: Start a revenue entry for every sailing on file
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        SailingRevenue entry;
+        entry.sailingID = rows[i].sailing.getSailingID();
+        entry.vehicles = 0;
+        entry.bookedCents = 0;
+        entry.collectedCents = static_cast<long long>(
+            std::nearbyint(static_cast<double>(rows[i].sailing.getRevenue()) * 100.0));
+        groupOf[entry.sailingID] = static_cast<uint32_t>(i);
+        report.sailings.push_back(entry);
+    }
+
+    std::vector<Vehicle> vehicles;
+    FileIOforVehicle vehicleIO;
+    if (vehicleIO.open())
+    {
+        vehicles = vehicleIO.getAllVehicles();
+        vehicleIO.close();
+    }
+    std::unordered_map<std::string, size_t> vehicleOf;
+    // Loop goal: Index the vehicles by license plate
+    for (size_t i = 0; i < vehicles.size(); ++i)
+    {
+        vehicleOf[vehicles[i].getLicense()] = i;
+    }
+
+    std::vector<ReservationRecord> reservations = getAllReservations();
+    size_t count = reservations.size();
+
+    // Structure-of-arrays columns, one row per reservation
+    std::vector<float> special(count), length(count), height(count);
+    std::vector<uint32_t> group(count);
+    std::vector<int32_t> cents(count);
+
+    // Join each chunk of reservations with its sailing group and
+    // vehicle dimensions (the maps are only read here), then price it
+    parallelFor(count, REVENUE_CHUNK, [&](size_t begin, size_t end)
+    {
+        // Loop goal: Fill the columns for each reservation in the chunk
+        for (size_t i = begin; i < end; ++i)
+        {
+            const ReservationRecord &rec = reservations[i];
+            std::unordered_map<std::string, uint32_t>::const_iterator g =
+                groupOf.find(boundedString(rec.sailingID, SAILING_ID_MAX));
+            group[i] = g != groupOf.end() ? g->second : NO_GROUP;
+
+            std::unordered_map<std::string, size_t>::const_iterator v =
+                vehicleOf.find(boundedString(rec.licensePlate, LICENSE_PLATE_MAX));
+            const Vehicle *vehicle = v != vehicleOf.end() ? &vehicles[v->second] : NULL;
+            special[i] = vehicle != NULL && vehicle->isSpecial() ? 1.0f : 0.0f;
+            length[i] = vehicle != NULL ? vehicle->getLength() : 0.0f;
+            height[i] = vehicle != NULL ? vehicle->getHeight() : 0.0f;
+        }
+        computeFareCents(&special[begin], &length[begin], &height[begin],
+                         &cents[begin], end - begin);
+    });
+
+    // Loop goal: Add each fare to its sailing, giving reservations on
+    // sailings missing from the table an entry of their own
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (group[i] == NO_GROUP)
+        {
+            std::string sailingID = boundedString(reservations[i].sailingID, SAILING_ID_MAX);
+            std::unordered_map<std::string, uint32_t>::const_iterator g = groupOf.find(sailingID);
+            if (g == groupOf.end())
+            {
+                SailingRevenue entry;
+                entry.sailingID = sailingID;
+                entry.vehicles = 0;
+                entry.bookedCents = 0;
+                entry.collectedCents = 0;
+                g = groupOf.insert(std::make_pair(sailingID,
+                        static_cast<uint32_t>(report.sailings.size()))).first;
+                report.sailings.push_back(entry);
+            }
+            group[i] = g->second;
+        }
+        SailingRevenue &entry = report.sailings[group[i]];
+        ++entry.vehicles;
+        entry.bookedCents += cents[i];
+        report.totalCents += cents[i];
+    }
+
+    // Loop goal: Roll the sailings up by day of month (TTT-DD-HH)
+    std::map<std::string, DayRevenue> byDay;
+    for (size_t i = 0; i < report.sailings.size(); ++i)
+    {
+        const SailingRevenue &entry = report.sailings[i];
+        std::string day = entry.sailingID.size() >= 6 ? entry.sailingID.substr(4, 2) : "";
+        std::map<std::string, DayRevenue>::iterator total = byDay.find(day);
+        if (total == byDay.end())
+        {
+            DayRevenue first;
+            first.day = day;
+            first.vehicles = 0;
+            first.bookedCents = 0;
+            total = byDay.insert(std::make_pair(day, first)).first;
+        }
+        total->second.vehicles += entry.vehicles;
+        total->second.bookedCents += entry.bookedCents;
+    }
+    // Loop goal: Copy the day totals out in ascending order
+    for (std::map<std::string, DayRevenue>::const_iterator it = byDay.begin();
+         it != byDay.end(); ++it)
+    {
+        report.days.push_back(it->second);
+    }
+
+    return report;
+}
@@ -0,0 +1,103 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the revenue report. Reservations are joined with
+//   their vehicles' dimensions into structure-of-arrays columns
+//   and priced by a branch-free fare kernel (AVX2 when the CPU
+//   has it, scalar otherwise). Totals are kept in integer cents
+//   per sailing and per day.
+//************************************************************
+// USAGE:
+// - Open the sailing, vehicle and reservation stores first,
+//   then call buildRevenueReport().
+// - computeFareCents() prices whole columns; each result equals
+//   fareToCents(calculateFare(...)) for the same vehicle.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial SoA revenue report and SIMD fare kernel.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Added computeFareCentsPortable() for kernel tests.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef REVENUE_REPORT_H
+#define REVENUE_REPORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------
+// Revenue booked on one sailing.
+struct SailingRevenue
+{
+    std::string sailingID;     // Sailing ID
+    int vehicles;              // Reservations on the sailing
+    long long bookedCents;     // Fares of every reservation
+    long long collectedCents;  // Fares collected at check-in so far
+};
+
+//--------------------------------------------------
+// Revenue booked on one day of the month (all terminals).
+struct DayRevenue
+{
+    std::string day;           // Day of month from the sailing ID, "01"-"31"
+    int vehicles;              // Reservations on the day's sailings
+    long long bookedCents;     // Fares of every reservation
+};
+
+//--------------------------------------------------
+// Whole revenue report.
+struct RevenueReport
+{
+    std::vector<SailingRevenue> sailings; // In sailing file order
+    std::vector<DayRevenue> days;         // Ascending by day
+    long long totalCents;                 // Sum over every reservation
+};
+
+//--------------------------------------------------
+// Converts a fare in dollars to whole cents, rounding half to
+// even. Used by both kernels so their results agree exactly.
+int32_t fareToCents(
+    float fare  // in: fare in dollars
+);
+
+//--------------------------------------------------
+// Prices 'count' vehicles given as columns. 'special' holds 1.0
+// for special vehicles and 0.0 for regular ones.
+void computeFareCents(
+    const float *special,  // in: special flags
+    const float *length,   // in: lengths in meters
+    const float *height,   // in: heights in meters
+    int32_t *cents,        // out: fare of each vehicle in cents
+    size_t count           // in: number of vehicles
+);
+
+//--------------------------------------------------
+// Prices the columns like computeFareCents(), always with the
+// portable scalar kernel, so the two can be compared.
+void computeFareCentsPortable(
+    const float *special,  // in: special flags
+    const float *length,   // in: lengths in meters
+    const float *height,   // in: heights in meters
+    int32_t *cents,        // out: fare of each vehicle in cents
+    size_t count           // in: number of vehicles
+);
+
+//--------------------------------------------------
+// Returns true if computeFareCents() runs the AVX2 kernel.
+bool fareKernelUsesAVX2();
+
+//--------------------------------------------------
+// Builds the per-sailing and per-day revenue report from every
+// reservation on file. Vehicles missing from the vehicle file
+// are charged the regular fare.
+RevenueReport buildRevenueReport();
+
+#endif // REVENUE_REPORT_H
@@ -5,8 +5,9 @@
 // PURPOSE:
 //   Implements the Sailing class, which manages sailing records
 //   including creation, editing, and persistence through file //I/O.
-//   Provides functionality for adding, editing, and retrieving //sailings,
-//   as well as handling user input for sailing management.
+//   Provides functionality for adding, editing, and retrieving //sailings.
+//   The prompts for sailings are in sailingMenu.cpp; nothing here
+//   reads cin or writes cout.
 //************************************************************
 // REVISION HISTORY:
 // Rev. 1 - 2025/07/09 - Nathan Miller
@@ -15,401 +16,208 @@
 //          - Finalized format and synced with .cpp logic.
 // Rev. 3 - 2025/08/05 - Nathan Miller
 //          - Fully debugged final release version.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - Rescheduling a sailing moves its reservations.
+//          - Deleting a sailing deletes its reservations.
+//          - Maintained reservation counters and revenue.
+//          - Report pages with SailingCursor (previous/next/go to page).
+//          - Added the filtered, ranked sailing query report.
+//          - Sailing operations are recorded in the operation trace;
+//            edits, deletes and report pages have headless entry
+//            points for replay.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - Moved the prompts to sailingMenu.cpp and added the
+//            headless addSailing() for the libfrss core library.
+// Rev. 6 - 2026/10/18 - Group 19
+//          - Sailing operations record latency statistics.
+// Rev. 7 - 2026/10/18 - Group 19
+//          - deleteWithReservations() deletes the reservations
+//            before the sailing and fails if they can't be deleted.
+// Rev. 8 - 2026/10/18 - Group 19
+//          - applyEdit() refuses lane lengths shorter than the space
+//            already taken, for the menu, batch and replay alike.
+//          - A reschedule fails if the old sailing can't be deleted
+//            once its reservations have moved.
+//          - An edit that keeps the ID overwrites the sailing in
+//            place, and a reschedule stops if the new sailing can't
+//            be saved.
 //************************************************************
 
 
 #include "sailing.h"
+#include "latencyStats.h"
 #include "sailingFileIO.h"
-#include "ui.h"
+#include "reservation.h"
 #include <iostream>
 #include <iomanip>
 #include <cstring>
-#include <limits>
 #include <algorithm>
 #include <vector>
 #include <sstream>
 
 using namespace std;
 
-// cancel is always 0 so using a constant for it makes sense
-const int CANCEL_OPTION = 0;
+// column widths used by the sailing reports
+const int VESSEL_ID_LENGTH = 25;
+const int LRL_LENGTH = 6;
+const int HRL_LENGTH = 6;
+const int PERCENT_LENGTH = 6;
+const int COUNT_LENGTH = 5;
 
 // public functions
-bool Sailing::addSailing()
+bool Sailing::addSailing(const char *sailingID, const string &vessel, int lcll, int hcll)
 {
-    const char SID_SEPARATOR = '-';
-    const int CONFIRM_OPTION = 1;
-
-    // uses helper functions to prompt the user for and create the sailing id
-    UI::displayHeader("Add Sailing");
-    string depTerm = addDepTerm();
-    string date = addDate();
-    string time = addTime();
-
-    // forms the sailing id according to the ord, converts to char array
-    string sidString = depTerm + SID_SEPARATOR + date + SID_SEPARATOR + time;
-    char sid[10];
-
-    strcpy(sid, sidString.c_str());
-    sid[sizeof(sid) - 1] = '\0';
-
-    // aborts the process if the sailing already exists
-    if (sailingFileIO::exists(sid))
-    {
-        cout << "Sailing with ID " << sid << " already exists.\n";
-        return false;
-    }
-
-    // uses helper functions to prompt the user for the rest of the sailing information.
-    string vessel = addVessel();
-    int lcll = addLCLL();
-    int hcll = addHCLL();
-
-    // displays the sailing information before prompting the user to confirm
-    cout << "\nDeparture Terminal: " << depTerm << "\n";
-    cout << "Departure Date: " << date << "\n";
-    cout << "Departure Time: " << time << "\n";
-    cout << "Vessel ID: " << vessel << "\n";
-    cout << "LCLL: " << lcll << "\n";
-    cout << "HCLL: " << hcll << "\n";
-
-    // confirms the entry, cancels if cancelled
-    if (!confirm(CONFIRM_OPTION))
+    static LatencyStat &stat = latencyStat("Sailing::addSailing");
+    LatencyTimer timer(stat);
+    size_t idLength = strlen(sailingID);
+    if (idLength == 0 || idLength >= SAILING_ID_MAX || vessel.empty() ||
+        vessel.size() > VESSEL_ID_MAX || lcll < 0 || lcll > LANE_LIMIT_MAX ||
+        hcll < 0 || hcll > LANE_LIMIT_MAX || sailingFileIO::exists(sailingID))
     {
-        // aborts this operation and hands control back to ui.cpp
-        return false;
+        return timer.result(false);
     }
 
-    // combines everything into a sailing
+    // a new sailing starts empty, with all of its deck space free
     Sailing s;
-    strcpy(s.sailingID, sid);
+    strcpy(s.sailingID, sailingID);
     strcpy(s.vesselID, vessel.c_str());
     s.lcll = lcll;
     s.hcll = hcll;
     s.lrl = lcll;
     s.hrl = hcll;
+    s.reservedCount = 0;
+    s.onboardCount = 0;
+    s.specialCount = 0;
+    s.revenue = 0.0f;
+    return timer.result(sailingFileIO::saveSailing(s));
+}
 
-    if (sailingFileIO::saveSailing(s))
+bool Sailing::applyEdit(const char *sailingID, const char *newSailingID, const string &vessel,
+                        int newLCLL, int newHCLL)
+{
+    static LatencyStat &stat = latencyStat("Sailing::applyEdit");
+    LatencyTimer timer(stat);
+    if (!sailingFileIO::exists(sailingID))
     {
-        cout << "Sailing Successfully Added. Returning to the main menu.\n";
-        UI::displayFooter();
-        return true;
+        return timer.result(false);
+    }
+    Sailing s = getSailingFromIO(sailingID);
+    strncpy(s.sailingID, newSailingID, sizeof(s.sailingID) - 1);
+    s.sailingID[sizeof(s.sailingID) - 1] = '\0';
+    strncpy(s.vesselID, vessel.c_str(), sizeof(s.vesselID) - 1);
+    s.vesselID[sizeof(s.vesselID) - 1] = '\0';
+    // the space already taken stays taken under the new limits
+    s.lrl = newLCLL - (s.lcll - s.lrl);
+    s.hrl = newHCLL - (s.hcll - s.hrl);
+    s.lcll = newLCLL;
+    s.hcll = newHCLL;
+    if (s.lrl < 0 || s.hrl < 0)
+    {
+        return timer.result(false);
     }
 
-    cout << "Error: Unable to add sailing.\n";
-    // if it fails to save, returns false to the UI
-    UI::displayFooter();
-    return false;
+    if (strcmp(sailingID, s.sailingID) == 0)
+    {
+        // same slot: overwrite in place so a failed write can't lose the sailing
+        return timer.result(sailingFileIO::saveSailing(s));
+    }
+
+    // rescheduled: the new sailing starts empty and takes the reservations,
+    // along with their deck space, from the old one
+    if (sailingFileIO::exists(s.sailingID))
+    {
+        return timer.result(false);
+    }
+    s.lrl = s.lcll;
+    s.hrl = s.hcll;
+    s.reservedCount = 0;
+    s.onboardCount = 0;
+    s.specialCount = 0;
+    s.revenue = 0.0f;
+    if (!sailingFileIO::saveSailing(s))
+    {
+        return timer.result(false);
+    }
+    if (moveReservations(sailingID, s.sailingID) < 0)
+    {
+        sailingFileIO::deleteSailing(s.sailingID);
+        return timer.result(false);
+    }
+    return timer.result(sailingFileIO::deleteSailing(sailingID));
 }
 
-void Sailing::editSailing()
+int Sailing::deleteWithReservations(const char *sailingID)
 {
-    bool editing = true;
-    int input;
-    Sailing s = *this;
-    
-    // Validate that this sailing has valid data before proceeding
-    if (strlen(s.sailingID) == 0 || s.sailingID[0] == '\0') {
-        UI::displayHeader("Edit Sailing");
-        cout << "Error: Invalid sailing data. Cannot edit this sailing.\n";
-        UI::displayFooter();
-        return;
+    static LatencyStat &stat = latencyStat("Sailing::deleteWithReservations");
+    LatencyTimer timer(stat);
+    if (!sailingFileIO::exists(sailingID))
+    {
+        return timer.failWith(-1);
     }
-
-    // runs the editing loop until either confirm, cancel, delete, or manage reservations is chosen
-    // Loop goal: Continue editing sailing details until user chooses to confirm, cancel, delete, or manage reservations
-    while (editing)
+    // reservations first: if they can't be deleted the sailing stays, so no
+    // reservation is left pointing at a sailing that is gone
+    int deleted = deleteAllOnSailing(sailingID);
+    if (deleted < 0 || !sailingFileIO::deleteSailing(sailingID))
     {
-        // used to keep track of order and options
-        enum editSailingOptions
-        {
-            DEP_TERM = 1,
-            DEP_DAY,
-            DEP_TIME,
-            VESSEL_ID,
-            LCLL,
-            HCLL,
-            NUM_OF_OPTIONS = 6
-        };
-
-        string sid = s.sailingID;
-        
-        // Additional validation: check if sailing ID has proper format
-        if (sid.length() < 7 || sid.find('-') == string::npos) {
-            UI::displayHeader("Edit Sailing");
-            cout << "Error: Invalid sailing ID format. Cannot edit this sailing.\n";
-            UI::displayFooter();
-            return;
-        }
-        
-        UI::displayHeader("Edit Sailing");
-        // Loop goal: Display all editing options in order (1 through NUM_OF_OPTIONS)
-        for (int i = 1; i <= NUM_OF_OPTIONS; i++)
-        {            
-            switch (i)
-            {
-            case DEP_TERM:
-                if (sid.length() >= 3) {
-                    cout << "[" << i << "] " << "Departure Terminal: " << sid.substr(0, 3) << "\n";
-                } else {
-                    cout << "[" << i << "] " << "Departure Terminal: [Invalid]\n";
-                }
-                break;
-
-            case DEP_DAY:
-                if (sid.length() >= 6) {
-                    cout << "[" << i << "] " << "Departure Day: " << sid.substr(4, 2) << "\n";
-                } else {
-                    cout << "[" << i << "] " << "Departure Day: [Invalid]\n";
-                }
-                break;
-
-            case DEP_TIME:
-                if (sid.length() >= 9) {
-                    cout << "[" << i << "] " << "Departure Time: " << sid.substr(7, 2) << "\n";
-                } else {
-                    cout << "[" << i << "] " << "Departure Time: [Invalid]\n";
-                }
-                break;
-
-            case VESSEL_ID:
-                cout << "[" << i << "] " << "Vessel ID: " << s.vesselID << "\n";
-                break;
-
-            case LCLL:
-                cout << "[" << i << "] " << "LCLL: " << s.lcll << "\n";
-                break;
-
-            case HCLL:
-                cout << "[" << i << "] " << "HCLL: " << s.hcll << "\n";
-                break;
-            }
-        }
-
-        // after two new lines, prints the options that aren't directly tied to editing the sailing.
-        const int CONFIRM_OPTION = 7;
-        const int RESERVATIONS_OPTION = 8;
-        const int DELETE_OPTION = 9;
-
-        cout << "\n[" << CANCEL_OPTION << "] Cancel\n";
-        cout << "[" << CONFIRM_OPTION << "] Confirm\n";
-        cout << "[" << RESERVATIONS_OPTION << "] Manage Reservations\n";
-        cout << "[" << DELETE_OPTION << "] Delete Sailing\n";
-
-        // prompts the user for input until they enter something valid.
-        cout << "\nEnter an Option: ";
-        cin >> input;
-        if (cin.fail() || input < CANCEL_OPTION || input > DELETE_OPTION)
-        {
-            cout << "Please enter a valid option.\n";
-            cin.clear();
-            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            UI::displayFooter();
-            continue; // Go back to the beginning of the loop
-        }
-        else
-        {
-            switch (input)
-            {
-            // returns control to UI if cancelled
-            case CANCEL_OPTION:
-                cout << "Changes Reverted. Returning to the main menu.\n";
-                return;
-                break;
-            case DEP_TERM:
-            {
-                string newDepTerm;
-                newDepTerm = addDepTerm();
-                const char *newDepTermC = newDepTerm.c_str();
-                s.sailingID[0] = newDepTermC[0];
-                s.sailingID[1] = newDepTermC[1];
-                s.sailingID[2] = newDepTermC[2];
-                // aborts the operation if the new sailing ID already exists
-                if (sailingFileIO::exists(s.sailingID))
-                {
-                    cout << "Sailing with ID " << s.sailingID << " already exists.\n";
-                    return;
-                }
-                break;
-            }
-            case DEP_DAY:
-            {
-                string newDepDay;
-                newDepDay = addDate();
-                const char *newDepDayC = newDepDay.c_str();
-                s.sailingID[4] = newDepDayC[0];
-                s.sailingID[5] = newDepDayC[1];
-                // aborts the operation if the new sailing ID already exists
-                if (sailingFileIO::exists(s.sailingID))
-                {
-                    cout << "Sailing with ID " << s.sailingID << " already exists.\n";
-                    return;
-                }
-                break;
-            }
-            case DEP_TIME:
-            {
-                string newDepTime;
-                newDepTime = addTime();
-                const char *newDepTimeC = newDepTime.c_str();
-                s.sailingID[7] = newDepTimeC[0];
-                s.sailingID[8] = newDepTimeC[1];
-                // aborts the operation if the new sailing ID already exists
-                if (sailingFileIO::exists(s.sailingID))
-                {
-                    cout << "Sailing with ID " << s.sailingID << " already exists.\n";
-                    return;
-                }
-                break;
-            }
-            break;
-            case VESSEL_ID:
-            {
-                string newVesselID;
-                newVesselID = addVessel();
-                const char *newVesselIDC = newVesselID.c_str();
-                strncpy(s.vesselID, newVesselIDC, sizeof(s.vesselID) - 1);
-                s.vesselID[sizeof(s.vesselID) - 1] = '\0';
-                break;
-            }
-            // ensures that new LCLL and HCLL will still allow for current reservations to fit
-            // prints an error and starts the loop over again if user enters an invalid new value
-            case LCLL:
-            {
-                int newLCLL = addLCLL();
-                if (newLCLL < s.lrl)
-                {
-                    cout << "Error: New LCLL is less than lrl\n";
-                    cin.clear();
-                    cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                }
-                else
-                {
-                    s.lrl = newLCLL - (s.lcll - s.lrl);
-                    s.lcll = newLCLL;
-                }
-                break;
-            }
-            case HCLL:
-            {
-                int newHCLL = addHCLL();
-                if (newHCLL < s.hrl)
-                {
-                    cout << "Error: New HCLL is less than hrl\n";
-                    cin.clear();
-                    cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-                }
-                else
-                {
-                    s.hrl = newHCLL - (s.hcll - s.hrl);
-                    s.hcll = newHCLL;
-                }
-                break;
-            }
-            case CONFIRM_OPTION:
-            {
-                editing = false;
-
-                // also needs to call move reservations, add when relevant
-                sailingFileIO::deleteSailing(sailingID);
-
-                sailingFileIO::saveSailing(s);
-
-                cout << "Changes Successfully Saved. Returning to the main menu.\n";
-                break;
-            }
-            // opens manage reservations for this sailing, requires reservation class
-            case RESERVATIONS_OPTION:
-            {
-                UI::manageReservationsForSailing(s.sailingID);
-                break;
-            }
-            case DELETE_OPTION:
-            {
-                editing = false;
-                if (sailingFileIO::deleteSailing(s.sailingID))
-                {
-                    cout << "Sailing Successfully Deleted. Returning to the main menu.\n";
-                }
-                break;
-            }
-            }
-        }
-        UI::displayFooter();
+        return timer.failWith(-1);
     }
+    return deleted;
+}
+
+void Sailing::printReportHeader(ostream &out)
+{
+    out << "SAILING ID" << "  ";
+    out << left << setw(VESSEL_ID_LENGTH) << "VESSEL ID" << "   ";
+    out << right << setw(LRL_LENGTH) << "LRL" << "   ";
+    out << right << setw(HRL_LENGTH) << "HRL" << "  ";
+    out << right << "FULL %" << "  ";
+    out << right << setw(COUNT_LENGTH) << "RESV" << "  ";
+    out << right << setw(COUNT_LENGTH) << "ONBD" << "\n";
+}
+
+void Sailing::printReportRow(ostream &out, const SailingReportRow &row)
+{
+    const Sailing &s = row.sailing;
+    // prints the sailing information formatted according to the user manual
+    out << s.sailingID << "   ";
+    out << left << setw(VESSEL_ID_LENGTH) << s.vesselID << "   ";
+    out << right << setw(LRL_LENGTH) << s.lrl << "   ";
+    out << right << setw(HRL_LENGTH) << s.hrl << "   ";
+    out << right << setw(PERCENT_LENGTH) << fixed << setprecision(1) << row.percentFull << "%";
+    out << resetiosflags(ios::fixed) << setprecision(6); // Reset formatting
+    out << "  " << right << setw(COUNT_LENGTH) << s.reservedCount;
+    out << "  " << right << setw(COUNT_LENGTH) << s.onboardCount << "\n";
 }
 
-void Sailing::displayReport()
+void Sailing::writeReportPage(ostream &out, const SailingCursor &cursor)
 {
-    // initializes variables required for the for loop
-    bool reportActive = true;
-    const int VESSEL_ID_LENGTH = 25;
-    const int LRL_LENGTH = 6;
-    const int HRL_LENGTH = 6;
-    const int PERCENT_LENGTH = 6;
-
-    // resets position in the file so it starts at the beginning every time
-    sailingFileIO::reset();
-
-    // Loop goal: Continue displaying sailing reports until user chooses to exit
-    while (reportActive)
+    static LatencyStat &stat = latencyStat("Sailing::writeReportPage");
+    LatencyTimer timer(stat);
+    const vector<SailingReportRow> &rows = sailingFileIO::reportRows();
+    printReportHeader(out);
+    // Loop goal: Write the sailing records on the cursor's current page
+    for (size_t i = cursor.begin(); i < cursor.end(); i++)
     {
-        UI::displayHeader("Sailing Report");
-        // grabs up to the first five sailings saved in the system
-        Sailing *fiveSailings = sailingFileIO::getNextFive();
-
-        cout << "SAILING ID" << "  ";
-        cout << left << setw(VESSEL_ID_LENGTH) << "VESSEL ID" << "   ";
-        cout << right << setw(LRL_LENGTH) << "LRL" << "   ";
-        cout << right << setw(HRL_LENGTH) << "HRL" << "  ";
-        cout << right << "FULL %" << "\n";
-        // Loop goal: Display up to 5 sailing records from the current file position
-        for (int i = 0; i < 5; i++)
-        {
-            if (fiveSailings[i].getSailingID()[0] == '\0')
-            {
-                // if the sailingID is empty, it means there are no more sailings to display, user can loop through them again with '5'
-                sailingFileIO::reset();
-                break;
-            }
-            // prints the sailing information formatted according to the user manual
-            cout << fiveSailings[i].sailingID << "   ";
-            cout << left << setw(VESSEL_ID_LENGTH) << fiveSailings[i].vesselID << "   ";
-            cout << right << setw(LRL_LENGTH) << fiveSailings[i].lrl << "   ";
-            cout << right << setw(HRL_LENGTH) << fiveSailings[i].hrl << "   ";
-            
-            // Calculate and display capacity percentage
-            float percentFull = calculateCapacityPercentage(fiveSailings[i].lcll, fiveSailings[i].hcll, 
-                                                         fiveSailings[i].lrl, fiveSailings[i].hrl);
-            cout << right << setw(PERCENT_LENGTH) << fixed << setprecision(1) << percentFull << "%";
-            cout << resetiosflags(ios::fixed) << setprecision(6) << "\n"; // Reset formatting
-        }
+        printReportRow(out, rows[i]);
+    }
+    out << "\nPage " << cursor.currentPage() + 1 << " of " << cursor.pageCount() << "\n";
+}
 
-        // prompts the user to enter an option, continues until valid input is received
-        cout << "\n[0] Cancel\n[5] Show next 5\n\nEnter an option: ";
-        int input;
-        bool validInput = false;
-        // Loop goal: Keep prompting until user enters a valid option (0 or 5)
-        while (!validInput)
-        {
-            cin >> input;
-            if (cin.fail() || (input != CANCEL_OPTION && input != 5))
-            {
-                cout << "Invalid option, please enter an option: ";
-                cin.clear();
-                cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-            }
-            else
-            {
-                validInput = true;
-                if (input == CANCEL_OPTION)
-                {
-                    reportActive = false;
-                }
-            }
-        }
-        UI::displayFooter();
+size_t Sailing::writeQueryResults(ostream &out, const SailingQuery &q)
+{
+    static LatencyStat &stat = latencyStat("Sailing::writeQueryResults");
+    LatencyTimer timer(stat);
+    vector<size_t> matches = sailingFileIO::query(q);
+    const vector<SailingReportRow> &rows = sailingFileIO::reportRows();
+
+    printReportHeader(out);
+    // Loop goal: Write each matching sailing in ranked order
+    for (size_t i = 0; i < matches.size(); i++)
+    {
+        printReportRow(out, rows[matches[i]]);
     }
+    out << "\n" << matches.size() << " sailing(s) shown.\n";
+    return matches.size();
 }
 
 // nothing needs to be initialized or shutdown here so these are just to initialize and shutdown file IO.
@@ -429,19 +237,23 @@ const char *Sailing::getSailingID() const
 
 Sailing Sailing::getSailingFromIO(const char *sid)
 {
+    static LatencyStat &stat = latencyStat("Sailing::getSailingFromIO");
+    LatencyTimer timer(stat);
     return sailingFileIO::getSailing(sid);
 }
 
 // functions for updating the lrl and hrl of a specific sailing, subtracts f from lrl or hrl
 bool Sailing::lrlUpdate(float f)
 {
+    static LatencyStat &stat = latencyStat("Sailing::lrlUpdate");
+    LatencyTimer timer(stat);
     if (lrl - f >= 0)
     {
         lrl -= f;
         sailingFileIO::saveSailing(*this);
         return true;
     }
-    return false;
+    return timer.result(false);
 }
 
 float Sailing::lrlRemaining() const
@@ -451,13 +263,29 @@ float Sailing::lrlRemaining() const
 
 bool Sailing::hrlUpdate(float f)
 {
+    static LatencyStat &stat = latencyStat("Sailing::hrlUpdate");
+    LatencyTimer timer(stat);
     if (hrl - f >= 0)
     {
         hrl -= f;
         sailingFileIO::saveSailing(*this);
         return true;
     }
-    return false;
+    return timer.result(false);
+}
+
+bool Sailing::reserveCapacity(float length, float height)
+{
+    static LatencyStat &stat = latencyStat("Sailing::reserveCapacity");
+    LatencyTimer timer(stat);
+    if (lrl - length < 0 || hrl - height < 0)
+    {
+        return timer.result(false);
+    }
+    // released space never takes the sailing past its limits
+    lrl = min(lrl - length, static_cast<float>(lcll));
+    hrl = min(hrl - height, static_cast<float>(hcll));
+    return timer.result(sailingFileIO::saveSailing(*this));
 }
 
 float Sailing::hrlRemaining() const
@@ -487,219 +315,32 @@ float Sailing::getHRL() const {
     return hrl;
 }
 
-// private functions
-string Sailing::addDepTerm()
-{
-    bool validEntry = false;
-    const int DEP_TERM_LENGTH = 3;
-    string depTerm;
-    // Loop goal: Keep prompting until user enters a valid 3-character departure terminal
-    while (!validEntry)
-    {
-        cout << "Format: 3-letter terminal code (e.g., TSA, SWB, HGB)\n";
-        cout << "Enter a departure terminal: ";
-
-        cin >> depTerm;
-
-        // departure terminal is represented by 3 characters
-        if (depTerm.length() != DEP_TERM_LENGTH)
-        {
-            cout << "Invalid departure terminal. Must be exactly 3 characters.\n";
-            cin.clear();
-            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        else
-        {
-            validEntry = true;
-        }
-    }
-    return depTerm;
-}
-
-string Sailing::addDate()
-{
-    bool validEntry = false;
-    const int DATE_LENGTH = 2;
-    string date;
-    // Loop goal: Keep prompting until user enters a valid 2-digit date (01-28)
-    while (!validEntry)
-    {
-        cout << "Format: 2-digit day (01-28, e.g., 01, 15, 28)\n";
-        cout << "Enter a departure date: ";
-
-        cin >> date;
-        // date entered should be two digits to represent the date, month is not relevant
-        if (date.length() != DATE_LENGTH || !std::all_of(date.begin(), date.end(), ::isdigit) || stoi(date) < 0 || stoi(date) > 28)
-        {
-            cout << "Invalid departure date. Must be 2 digits between 01-28.\n";
-            cin.clear();
-            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        else
-        {
-            validEntry = true;
-        }
-    }
-    return date;
+int Sailing::getReservedCount() const {
+    return reservedCount;
 }
 
-string Sailing::addTime()
-{
-    bool validEntry = false;
-    const int TIME_LENGTH = 2;
-    string time;
-    // Loop goal: Keep prompting until user enters a valid 2-digit time (00-23)
-    while (!validEntry)
-    {
-        cout << "Format: 2-digit hour in 24-hour format (00-23, e.g., 08, 14, 23)\n";
-        cout << "Enter a departure time: ";
-
-        cin >> time;
-        // time entered should be two digits in 24 hour time, can't be below 0 or above 23
-        if (time.length() != TIME_LENGTH || !std::all_of(time.begin(), time.end(), ::isdigit) || stoi(time) < 0 || stoi(time) > 23)
-        {
-            cout << "Invalid departure time. Must be 2 digits between 00-23.\n";
-            cin.clear();
-            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        else
-        {
-            validEntry = true;
-        }
-    }
-    return time;
+int Sailing::getOnboardCount() const {
+    return onboardCount;
 }
 
-string Sailing::addVessel()
-{
-    bool validEntry = false;
-    const int VESSEL_LENGTH = 25;
-    string vessel;
-    // Loop goal: Keep prompting until user enters a valid vessel ID (1-25 characters)
-    while (!validEntry)
-    {
-        cout << "\nVessel ID/Name:\n";
-        cout << "Format: Vessel name or identifier\n";
-        cout << "Guidelines:\n";
-        cout << "  - 1-25 characters maximum\n";
-        cout << "  - Can be name or alphanumeric ID\n";
-        cout << "  - No spaces (use underscore if needed)\n";
-        cout << "  - Examples: CoastalRunner, Island_Voyager, FERRY123, Vessel_01\n";
-        cout << "Enter a vessel ID: ";
-
-        cin >> vessel;
-        // vesselID can be between 1 and 25 characters
-        if (vessel.length() > VESSEL_LENGTH || vessel.length() == 0)
-        {
-            cout << "Invalid vessel ID. Must be 1-25 characters long.\n";
-            cin.clear();
-            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        else
-        {
-            validEntry = true;
-        }
-    }
-    return vessel;
+int Sailing::getSpecialCount() const {
+    return specialCount;
 }
 
-int Sailing::addLCLL()
-{
-    bool validEntry = false;
-    int lcll;
-    const int LCLL_MAX = 9999;
-
-    // Loop goal: Keep prompting until user enters a valid LCLL value (0-9999)
-    while (!validEntry)
-    {
-        cout << "\nLow Car Length Limit (LCLL):\n";
-        cout << "Format: Maximum length for regular vehicles in meters\n";
-        cout << "Guidelines:\n";
-        cout << "  - Enter as whole number (0-9999)\n";
-        cout << "  - Represents maximum length capacity for regular vehicles\n";
-        cout << "  - Common values: 100, 150, 200, 300, 500\n";
-        cout << "  - Examples: 111 (111 meters), 200 (200 meters)\n";
-        cout << "Enter LCLL: ";
-        cin >> lcll;
-
-        // reprompts user if entered value is not a float or too big/small.
-        // value is converted to DDDD.D form when saved.
-        if (cin.fail() || lcll > LCLL_MAX || lcll < 0)
-        {
-            cout << "Invalid LCLL. Must be a number between 0-9999.\n";
-            cin.clear();
-            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        else
-        {
-            validEntry = true;
-        }
-    }
-    return lcll;
+int Sailing::getRegularCount() const {
+    return reservedCount - specialCount;
 }
 
-int Sailing::addHCLL()
-{
-    bool validEntry = false;
-    int hcll;
-    const int HCLL_MAX = 9999;
-
-    // Loop goal: Keep prompting until user enters a valid HCLL value (0-9999)
-    while (!validEntry)
-    {
-        cout << "\nHigh Clearance Lane Limit (HCLL):\n";
-        cout << "Format: Maximum length for special vehicles in meters\n";
-        cout << "Guidelines:\n";
-        cout << "  - Enter as whole number (0-9999)\n";
-        cout << "  - Represents maximum length capacity for special/oversized vehicles\n";
-        cout << "  - Usually higher than LCLL\n";
-        cout << "  - Common values: 200, 300, 500, 1000\n";
-        cout << "  - Examples: 222 (222 meters), 300 (300 meters)\n";
-        cout << "Enter HCLL: ";
-        cin >> hcll;
-
-        // reprompts user if entered value is not a float or too big/small.
-        // value is converted to DDDD.D form when saved.
-        if (cin.fail() || hcll > HCLL_MAX || hcll < 0)
-        {
-            cout << "Invalid HCLL. Must be a number between 0-9999.\n";
-            cin.clear();
-            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        else
-        {
-            validEntry = true;
-        }
-    }
-    return hcll;
+float Sailing::getRevenue() const {
+    return revenue;
 }
 
-bool Sailing::confirm(int confirmOption)
+void Sailing::adjustCounters(int reservedDelta, int specialDelta, int onboardDelta, float revenueDelta)
 {
-    // Loop goal: Keep prompting until user enters valid confirmation choice (cancel or confirm)
-    while (true)
-    {
-        int input;
-        cout << "\n[" << CANCEL_OPTION << "] Cancel\n";
-        cout << "[" << confirmOption << "] Confirm\n\n";
-        cout << "Enter an option: ";
-        cin >> input;
-        if (cin.fail() || (input != CANCEL_OPTION && input != confirmOption))
-        {
-            cout << "Invalid option.\n";
-            cin.clear();
-            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        else if (input == CANCEL_OPTION)
-        {
-            return false;
-        }
-        else
-        {
-            return true;
-        }
-    }
-    return true;
+    reservedCount = max(0, reservedCount + reservedDelta);
+    specialCount = max(0, specialCount + specialDelta);
+    onboardCount = max(0, onboardCount + onboardDelta);
+    revenue += revenueDelta;
 }
 
 // Helper function to calculate capacity percentage for sailing reports
@@ -725,6 +366,10 @@ void Sailing::createSailing(string line) {
     hcll = 0;
     lrl = 0.0f;
     hrl = 0.0f;
+    reservedCount = 0;
+    onboardCount = 0;
+    specialCount = 0;
+    revenue = 0.0f;
     
     if (line.empty()) {
         return;
@@ -758,6 +403,14 @@ void Sailing::createSailing(string line) {
             lrl = stof(fields[4]);
             hrl = stof(fields[5]);
         }
+
+        // Optional counters: reservedCount|onboardCount|specialCount|revenue
+        if (fields.size() >= 10) {
+            reservedCount = stoi(fields[6]);
+            onboardCount = stoi(fields[7]);
+            specialCount = stoi(fields[8]);
+            revenue = stof(fields[9]);
+        }
     } catch (const exception& e) {
         cerr << "Error parsing sailing line: " << e.what() << endl;
         // Reset to empty state on error
@@ -767,22 +420,9 @@ void Sailing::createSailing(string line) {
         hcll = 0;
         lrl = 0.0f;
         hrl = 0.0f;
-    }
-}
-
-//-----------------------------------------------------------------------------------------
-// Static method to edit a sailing by sailing ID with validation
-void Sailing::editSailing(const char *sailingID)
-{
-    // Get the sailing object from the file I/O system
-    if (!sailingFileIO::exists(sailingID))
-    {
-        cout << "Sailing with ID " << sailingID << " does not exist.\n";
-        return;
-    }
-    else
-    {
-        Sailing s = Sailing::getSailingFromIO(sailingID);
-        s.editSailing();
+        reservedCount = 0;
+        onboardCount = 0;
+        specialCount = 0;
+        revenue = 0.0f;
     }
 }
@@ -15,17 +15,43 @@
 //          - Finalized format and synced with .cpp logic.
 // Rev. 3 - 2025/08/05 - Nathan Miller
 //          - Fully debugged final release version.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - Added reserveCapacity() for all-or-nothing updates.
+//          - Added maintained reservation counters and revenue.
+//          - displayReport() is served from the in-memory report table.
+//          - Added displayQueryReport() for filtered, ranked reports.
+//          - Added headless applyEdit(), deleteWithReservations(),
+//            writeReportPage() and writeQueryResults() for replay.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - Moved addSailing(), editSailing(), displayReport() and
+//            displayQueryReport() prompts to sailingMenu.h; added
+//            the headless addSailing().
 //************************************************************
 
 #ifndef SAILING_H
 #define SAILING_H
 
+#include <cstddef>
+#include <iosfwd>
 #include <string>
 using namespace std;
 
+// row of the sailing report table, report paging cursor and report query, defined in
+// sailingFileIO.h
+struct SailingReportRow;
+class SailingCursor;
+struct SailingQuery;
+
+// sailings shown on each page of the sailing report
+const size_t REPORT_PAGE_SIZE = 5;
+
+// longest vessel ID, and the largest LCLL or HCLL, a sailing accepts
+const size_t VESSEL_ID_MAX = 25;
+const int LANE_LIMIT_MAX = 9999;
+
 //-----------------------------------------------------------------------------------------
 // Sailing class used to interface with the file io for sailing class as well as create sailings.
-// Also used to navigate through the manage sailings menu.
+// Never reads cin or writes cout; the manage sailings screens are in sailingMenu.h.
 class Sailing
 {
 private:
@@ -41,39 +67,54 @@ private:
     float lrl;
     // the remaining space for special vehicles on the vessel.
     float hrl;
-
-    // helper function to handle the departure terminal entry for add sailing
-    static string addDepTerm();
-    // helper function to handle the date entry for add sailing
-    static string addDate();
-    // helper function to handle the time entry for add sailing
-    static string addTime();
-    // helper function to handle the vesselID entry for add sailing
-    static string addVessel();
-    // helper function to handle the LCLL entry for add sailing
-    static int addLCLL();
-    // helper function to handle the HCLL entry for add sailing
-    static int addHCLL();
-    // helper function to prompt the user to confirm the operation they are doing
-    static bool confirm(int confirmInput);
-    // helper function to calculate capacity percentage for sailing reports
+    // number of vehicles reserved on the sailing.
+    int reservedCount;
+    // number of reserved vehicles already checked in.
+    int onboardCount;
+    // number of reserved vehicles that are special vehicles.
+    int specialCount;
+    // total fares collected at check-in so far.
+    float revenue;
+
+    // helper function to print the column headings of a sailing report
+    static void printReportHeader(ostream &out);
+    // helper function to print one sailing report row
+    static void printReportRow(ostream &out, const SailingReportRow &row);
+public:
+    //-----------------------------------------------------------------------------------------
+    // calculates how full a sailing is, as a percentage of its combined lane limits
     static float calculateCapacityPercentage(int totalLow, int totalHigh, float remainingLow, float remainingHigh);
 
-public:
     //-----------------------------------------------------------------------------------------
-    // initializes a sailing object according to user input, returns false if already in database
-    static bool addSailing();
+    // saves a new, empty sailing without prompting. Returns false if the sailing ID is taken
+    // or a value is out of range (vessel ID 1-25 characters, LCLL and HCLL 0-9999).
+    static bool addSailing(
+        const char *sailingID,      // in: sailing ID, TTT-DD-HH
+        const string &vessel,       // in: vessel ID
+        int lcll,                   // in: low ceiling lane length
+        int hcll);                  // in: high ceiling lane length
 
     // creates a sailing using a line in the data file
     void createSailing(string line);
 
     //-----------------------------------------------------------------------------------------
-    // opens a sailing to be deleted and/or view the information saved on it
-    void editSailing();
+    // saves an edit of a sailing without prompting: space already taken stays taken under the
+    // new limits. A new sailing ID reschedules the sailing, moving its reservations and their
+    // space. Returns false if the sailing is missing, the new ID is taken, the reservations
+    // don't fit or a write fails.
+    static bool applyEdit(
+        const char *sailingID,      // in: sailing to edit
+        const char *newSailingID,   // in: sailing ID after the edit
+        const string &vessel,       // in: vessel ID after the edit
+        int newLCLL,                // in: LCLL after the edit
+        int newHCLL);               // in: HCLL after the edit
 
     //-----------------------------------------------------------------------------------------
-    // static method to edit a sailing by sailing ID with validation
-    static void editSailing(const char *sailingID);
+    // deletes all of a sailing's reservations, then the sailing, without prompting. Returns
+    // the number of reservations deleted, or -1 if the reservations or the sailing could not
+    // be deleted (the sailing is kept if its reservations could not be).
+    static int deleteWithReservations(
+        const char *sailingID);     // in: sailing to delete
 
     //-----------------------------------------------------------------------------------------
     // initializes this class as well as opens File I/O for Sailing class
@@ -103,6 +144,35 @@ public:
     // getter function for HRL
     float getHRL() const;
 
+    //-----------------------------------------------------------------------------------------
+    // getter function for the number of reserved vehicles
+    int getReservedCount() const;
+
+    //-----------------------------------------------------------------------------------------
+    // getter function for the number of checked-in vehicles
+    int getOnboardCount() const;
+
+    //-----------------------------------------------------------------------------------------
+    // getter function for the number of reserved special vehicles
+    int getSpecialCount() const;
+
+    //-----------------------------------------------------------------------------------------
+    // getter function for the number of reserved regular vehicles
+    int getRegularCount() const;
+
+    //-----------------------------------------------------------------------------------------
+    // getter function for the fares collected so far
+    float getRevenue() const;
+
+    //-----------------------------------------------------------------------------------------
+    // adjusts the reservation counters by the given amounts. Not saved on its own: the change
+    // is written together with the capacity by the next reserveCapacity() call.
+    void adjustCounters(
+        int reservedDelta,
+        int specialDelta,
+        int onboardDelta,
+        float revenueDelta);
+
     //-----------------------------------------------------------------------------------------
     // used by other classes to access sailings from sailingFileIO
     static Sailing getSailingFromIO(const char *sid);
@@ -130,8 +200,24 @@ public:
         float f);
 
     //-----------------------------------------------------------------------------------------
-    // interfaces with File I/O for Sailing Class to run the display report menu
-    static void displayReport();
+    // decrements both lrl and hrl and saves the sailing (with its counters) once. Neither is
+    // changed unless both fit,
+    // returns false if unable to. Negative values release capacity, capped at LCLL/HCLL.
+    bool reserveCapacity(
+        float length,
+        float height);
+
+    //-----------------------------------------------------------------------------------------
+    // writes the report page the cursor is on: headings, rows and page number
+    static void writeReportPage(
+        ostream &out,                   // in: stream to write to
+        const SailingCursor &cursor);   // in: page to write
+
+    //-----------------------------------------------------------------------------------------
+    // runs a report query and writes the matching rows; returns how many matched
+    static size_t writeQueryResults(
+        ostream &out,                   // in: stream to write to
+        const SailingQuery &q);         // in: filters, ordering and limit
 };
 
 #endif
\ No newline at end of file
@@ -14,18 +14,79 @@
 //          - Finalized format and synced with .cpp logic.
 // Rev. 3 - 2025/08/05 - Nathan Miller
 //          - Fully debugged final release version.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - SailingRecord carries reservation counters and revenue.
+//          - Lookups, saves and reports are served from an in-memory
+//            report table; saves write only the changed record.
+//          - Replaced getNextFive() with SailingCursor paging.
+//          - Added indexed report queries with top-k ranking.
+//          - Added bulkLoad() for generated data.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - The closed-file error goes to cerr, not cout.
+// Rev. 6 - 2026/10/18 - Group 19
+//          - Store operations record latency statistics.
+// Rev. 7 - 2026/10/18 - Group 19
+//          - Table loads, index rebuilds and flushes are span trace
+//            spans.
+//          - Record writes, seeks and reopens are counted in the
+//            storage I/O counters.
+// Rev. 8 - 2026/10/18 - Group 19
+//          - loadTable() decodes the records on the thread pool.
+// Rev. 9 - 2026/10/18 - Group 19
+//          - openFile() refuses data files that do not hold records
+//            of the current SailingRecord layout.
 //************************************************************
 
 
 #include "sailingFileIO.h"
+#include "latencyStats.h"
+#include "ioStats.h"
+#include "recordIO.h"
+#include "spanTrace.h"
+#include "threadPool.h"
 #include <vector>
 #include <algorithm>
 #include <cstring>
+#include <queue>
 
 using namespace std;
 
 const string FILE_NAME = "sailingData.dat";
+// records decoded per thread pool task when the table is loaded
+const size_t TABLE_CHUNK = 4096;
 fstream sailingFileIO::file;
+vector<SailingReportRow> sailingFileIO::rows;
+unordered_map<string, size_t> sailingFileIO::slots;
+sailingFileIO::SlotIndex sailingFileIO::byTerminal;
+sailingFileIO::SlotIndex sailingFileIO::byDay;
+sailingFileIO::SlotIndex sailingFileIO::byHour;
+sailingFileIO::SlotIndex sailingFileIO::byVessel;
+
+//--------------------------------------------------
+// Sailing IDs are TTT-DD-HH: terminal, day of month, hour
+//--------------------------------------------------
+static string terminalKey(const string& sid) { return sid.substr(0, 3); }
+static string dayKey(const string& sid) { return sid.size() >= 6 ? sid.substr(4, 2) : ""; }
+static string hourKey(const string& sid) { return sid.size() >= 9 ? sid.substr(7, 2) : ""; }
+
+// Two-digit key used by the day and hour indexes
+static string twoDigits(int value)
+{
+    char key[3];
+    key[0] = static_cast<char>('0' + (value / 10) % 10);
+    key[1] = static_cast<char>('0' + value % 10);
+    key[2] = '\0';
+    return key;
+}
+
+// Removes 'slot' from an ascending slot list
+static void eraseSlot(vector<size_t>& list, size_t slot)
+{
+    vector<size_t>::iterator it = lower_bound(list.begin(), list.end(), slot);
+    if (it != list.end() && *it == slot) {
+        list.erase(it);
+    }
+}
 
 //--------------------------------------------------
 // Binary record structure for Sailing data
@@ -37,6 +98,10 @@ struct SailingRecord {
     int hcll;              // Height car length limit
     float lrl;             // Load remaining length
     float hrl;             // Height remaining length
+    int reservedCount;     // Vehicles reserved
+    int onboardCount;      // Vehicles checked in
+    int specialCount;      // Reserved vehicles that are special
+    float revenue;         // Fares collected at check-in
 };
 
 //--------------------------------------------------
@@ -61,6 +126,10 @@ SailingRecord sailingToBinaryRecord(const Sailing& sailing) {
     record.hcll = sailing.getHCLL();
     record.lrl = sailing.getLRL();
     record.hrl = sailing.getHRL();
+    record.reservedCount = sailing.getReservedCount();
+    record.onboardCount = sailing.getOnboardCount();
+    record.specialCount = sailing.getSpecialCount();
+    record.revenue = sailing.getRevenue();
     
     return record;
 }
@@ -75,48 +144,154 @@ Sailing binaryRecordToSailing(const SailingRecord& record) {
                   to_string(record.lcll) + "|" +
                   to_string(record.hcll) + "|" +
                   to_string(record.lrl) + "|" +
-                  to_string(record.hrl);
+                  to_string(record.hrl) + "|" +
+                  to_string(record.reservedCount) + "|" +
+                  to_string(record.onboardCount) + "|" +
+                  to_string(record.specialCount) + "|" +
+                  to_string(record.revenue);
     
     sailing.createSailing(line);
     
     return sailing;
 }
 
+SailingReportRow sailingFileIO::makeRow(const Sailing& s)
+{
+    SailingReportRow row;
+    row.sailing = s;
+    row.percentFull = Sailing::calculateCapacityPercentage(s.getLCLL(), s.getHCLL(),
+                                                           s.getLRL(), s.getHRL());
+    return row;
+}
+
+void sailingFileIO::indexRow(size_t slot)
+{
+    const Sailing& s = rows[slot].sailing;
+    string sid = s.getSailingID();
+    // slots are indexed in ascending order, so each list stays sorted
+    byTerminal[terminalKey(sid)].push_back(slot);
+    byDay[dayKey(sid)].push_back(slot);
+    byHour[hourKey(sid)].push_back(slot);
+    byVessel[s.getVesselID()].push_back(slot);
+}
+
+void sailingFileIO::rebuildIndexes()
+{
+    SpanScope span("sailingFileIO::rebuildIndexes");
+    byTerminal.clear();
+    byDay.clear();
+    byHour.clear();
+    byVessel.clear();
+    // Loop goal: Index every row of the table
+    for (size_t i = 0; i < rows.size(); ++i) {
+        indexRow(i);
+    }
+}
+
+// True if a record decodes to sane values. Files written before the
+// reservation counters were added use a shorter record, so reading
+// them with this layout splits names across records and fails here.
+static bool plausibleRecord(const SailingRecord& record)
+{
+    if (memchr(record.sailingID, '\0', sizeof(record.sailingID)) == NULL ||
+        memchr(record.vesselID, '\0', sizeof(record.vesselID)) == NULL) {
+        return false;
+    }
+    if (record.lcll < 0 || record.lcll > LANE_LIMIT_MAX ||
+        record.hcll < 0 || record.hcll > LANE_LIMIT_MAX) {
+        return false;
+    }
+    return record.reservedCount >= 0 &&
+           record.onboardCount >= 0 && record.onboardCount <= record.reservedCount &&
+           record.specialCount >= 0 && record.specialCount <= record.reservedCount;
+}
+
+bool sailingFileIO::loadTable()
+{
+    SpanScope span("sailingFileIO::loadTable");
+    rows.clear();
+    slots.clear();
+
+    // a file of another record layout rarely divides into whole records
+    file.clear();
+    file.seekg(0, ios::end);
+    streamoff size = file.tellg();
+    countIO(IO_SEEKS);
+    if (size < 0 || size % static_cast<streamoff>(sizeof(SailingRecord)) != 0) {
+        rebuildIndexes();
+        return false;
+    }
+
+    vector<SailingRecord> all;
+    readAllRecords(file, all);
+    // Loop goal: Check every record decodes under the current layout
+    for (size_t i = 0; i < all.size(); ++i) {
+        if (!plausibleRecord(all[i])) {
+            rebuildIndexes();
+            return false;
+        }
+    }
+    rows.resize(all.size());
+    // Decoding is the slow part of a load; each chunk fills only its own rows
+    parallelFor(all.size(), TABLE_CHUNK, [&all](size_t begin, size_t end) {
+        // Loop goal: Build one report row per record in the chunk
+        for (size_t i = begin; i < end; ++i) {
+            rows[i] = makeRow(binaryRecordToSailing(all[i]));
+        }
+    });
+    // Loop goal: Index each row by sailing ID
+    for (size_t i = 0; i < rows.size(); ++i) {
+        slots[rows[i].sailing.getSailingID()] = i;
+    }
+    rebuildIndexes();
+    return true;
+}
+
 bool sailingFileIO::closeFile()
 {
+    static LatencyStat &stat = latencyStat("sailingFileIO::closeFile");
+    LatencyTimer timer(stat);
     if (file.is_open()) {
         file.close();
     }
-    return !file.is_open();
+    rows.clear();
+    slots.clear();
+    rebuildIndexes();
+    return timer.result(!file.is_open());
 }
 
 bool sailingFileIO::openFile()
 {
+    static LatencyStat &stat = latencyStat("sailingFileIO::openFile");
+    LatencyTimer timer(stat);
     file.open(FILE_NAME, ios::in | ios::out | ios::binary);
+    countIO(IO_REOPENS);
     // if opening doesn't work, creates the file
     if (!file.is_open())
     {
         createFile();
         file.open(FILE_NAME, ios::in | ios::out | ios::binary);
     }
-    return file.is_open();
+    if (file.is_open() && !loadTable()) {
+        cerr << "Error: " << FILE_NAME << " does not match the current sailing record "
+             << "layout; regenerate it (e.g. with setup_demo)." << endl;
+        file.close();
+    }
+    return timer.result(file.is_open());
 }
 
-void sailingFileIO::reset()
+const vector<SailingReportRow>& sailingFileIO::reportRows()
 {
-    file.clear();
-    file.seekg(0);
+    return rows;
 }
 
 Sailing sailingFileIO::getSailing(const char *sid)
 {
-    reset();
-    
-    SailingRecord record;
-    while (file.read(reinterpret_cast<char*>(&record), sizeof(SailingRecord))) {
-        if (string(record.sailingID) == string(sid)) {
-            return binaryRecordToSailing(record);
-        }
+    static LatencyStat &stat = latencyStat("sailingFileIO::getSailing");
+    LatencyTimer timer(stat);
+    unordered_map<string, size_t>::const_iterator slot = slots.find(sid);
+    if (slot != slots.end()) {
+        return rows[slot->second].sailing;
     }
     
     // Return empty sailing if not found
@@ -124,124 +299,144 @@ Sailing sailingFileIO::getSailing(const char *sid)
     return emptySailing;
 }
 
-Sailing *sailingFileIO::getNextFive()
-{
-    Sailing *fiveSailings = new Sailing[5];
-    
-    // Initialize all sailings to empty state
-    for (int i = 0; i < 5; i++) {
-        // Create an empty sailing with null-terminated sailingID
-        Sailing emptySailing;
-        // Ensure the sailingID is properly null-terminated to indicate empty
-        memset(&emptySailing, 0, sizeof(Sailing));
-        fiveSailings[i] = emptySailing;
-    }
-    
-    SailingRecord record;
-    for (int i = 0; i < 5; i++) {
-        if (file.read(reinterpret_cast<char*>(&record), sizeof(SailingRecord))) {
-            fiveSailings[i] = binaryRecordToSailing(record);
-        } else {
-            // If we can't read more records, break early
-            break;
-        }
-    }
-    
-    return fiveSailings;
-}
-
 bool sailingFileIO::exists(const char *sid)
 {
-    reset();
-    
-    SailingRecord record;
-    while (file.read(reinterpret_cast<char*>(&record), sizeof(SailingRecord))) {
-        if (string(record.sailingID) == string(sid)) {
-            return true;
-        }
-    }
-    return false;
+    static LatencyStat &stat = latencyStat("sailingFileIO::exists");
+    LatencyTimer timer(stat);
+    return slots.find(sid) != slots.end();
 }
 
 bool sailingFileIO::saveSailing(const Sailing s)
 {
+    static LatencyStat &stat = latencyStat("sailingFileIO::saveSailing");
+    LatencyTimer timer(stat);
     if (!file.is_open()) {
-        cout << "file not open";
-        return false;
+        cerr << "Sailing file not open." << endl;
+        return timer.result(false);
     }
     
     try {
         SailingRecord record = sailingToBinaryRecord(s);
+        // the table row holds the sailing as it reads back from the record
+        SailingReportRow row = makeRow(binaryRecordToSailing(record));
         
-        // Check if sailing already exists
-        if (exists(s.getSailingID())) {
-            // Update existing record
-            reset();
-            SailingRecord tempRecord;
-            streampos position = 0;
-            
-            while (file.read(reinterpret_cast<char*>(&tempRecord), sizeof(SailingRecord))) {
-                if (string(tempRecord.sailingID) == string(s.getSailingID())) {
-                    // Found the record, overwrite it
-                    file.seekp(position);
-                    file.write(reinterpret_cast<const char*>(&record), sizeof(SailingRecord));
-                    file.flush();
-                    return true;
+        file.clear();
+        unordered_map<string, size_t>::const_iterator slot = slots.find(row.sailing.getSailingID());
+        if (slot != slots.end()) {
+            // Update existing record in place
+            writeRecordAt(file, slot->second, record);
+            flushRecords(file);
+            if (!file) {
+                return timer.result(false);
+            }
+            // the ID fixes terminal, day and hour; only the vessel can move
+            string oldVessel = rows[slot->second].sailing.getVesselID();
+            if (oldVessel != row.sailing.getVesselID()) {
+                eraseSlot(byVessel[oldVessel], slot->second);
+                if (byVessel[oldVessel].empty()) {
+                    byVessel.erase(oldVessel);
                 }
-                position = file.tellg();
+                vector<size_t>& list = byVessel[row.sailing.getVesselID()];
+                list.insert(lower_bound(list.begin(), list.end(), slot->second), slot->second);
             }
+            rows[slot->second] = row;
         } else {
             // Append new record
-            file.clear();
-            file.seekp(0, ios::end);
-            file.write(reinterpret_cast<const char*>(&record), sizeof(SailingRecord));
-            file.flush();
-            return true;
+            writeRecordAt(file, rows.size(), record);
+            flushRecords(file);
+            if (!file) {
+                return timer.result(false);
+            }
+            slots[row.sailing.getSailingID()] = rows.size();
+            rows.push_back(row);
+            indexRow(rows.size() - 1);
         }
-        
-        return false;
+        return true;
     } catch (const exception& e) {
         cerr << "Exception in saveSailing: " << e.what() << endl;
-        return false;
+        return timer.result(false);
+    }
+}
+
+bool sailingFileIO::bulkLoad(const vector<Sailing>& sailings)
+{
+    static LatencyStat &stat = latencyStat("sailingFileIO::bulkLoad");
+    LatencyTimer timer(stat);
+    if (file.is_open()) {
+        return timer.result(false);
+    }
+    
+    try {
+        vector<SailingRecord> records;
+        records.reserve(sailings.size());
+        // Loop goal: Convert each sailing to its record
+        for (const auto& s : sailings) {
+            records.push_back(sailingToBinaryRecord(s));
+        }
+        ofstream out(FILE_NAME, ios::out | ios::binary | ios::trunc);
+        writeAllRecords(out, records);
+        out.close();
+        return timer.result(!out.fail());
+    } catch (const exception& e) {
+        cerr << "Exception in bulkLoad: " << e.what() << endl;
+        return timer.result(false);
     }
 }
 
 bool sailingFileIO::deleteSailing(const char *sid)
 {
+    static LatencyStat &stat = latencyStat("sailingFileIO::deleteSailing");
+    LatencyTimer timer(stat);
     if (!file.is_open()) {
-        return false;
+        return timer.result(false);
     }
     
     try {
-        // Read all records except the one to delete
+        // The table mirrors the file, so the survivors come from memory
         vector<SailingRecord> records;
-        reset();
-        
-        SailingRecord record;
-        while (file.read(reinterpret_cast<char*>(&record), sizeof(SailingRecord))) {
-            if (string(record.sailingID) != string(sid)) {
+        records.reserve(rows.size());
+        // Loop goal: Keep every record except the one being deleted
+        for (size_t i = 0; i < rows.size(); ++i) {
+            SailingRecord record = sailingToBinaryRecord(rows[i].sailing);
+            if (strncmp(record.sailingID, sid, sizeof(record.sailingID)) != 0) {
                 records.push_back(record);
             }
         }
+        if (records.size() == rows.size()) {
+            return true; // nothing to delete
+        }
         
         // Close and reopen file to truncate
         file.close();
         file.open(FILE_NAME, ios::out | ios::binary | ios::trunc);
         
         // Write back all records except the deleted one
-        for (const auto& rec : records) {
-            file.write(reinterpret_cast<const char*>(&rec), sizeof(SailingRecord));
-        }
+        writeAllRecords(file, records);
         
         file.close();
         
         // Reopen in read/write mode
         file.open(FILE_NAME, ios::in | ios::out | ios::binary);
+        countIO(IO_REOPENS);
         
-        return true;
+        // Drop the row and shift the slots of the rows after it
+        vector<SailingReportRow> kept;
+        kept.reserve(records.size());
+        slots.clear();
+        // Loop goal: Rebuild the table and index without the deleted sailing
+        for (size_t i = 0; i < rows.size(); ++i) {
+            if (strncmp(rows[i].sailing.getSailingID(), sid, sizeof(SailingRecord::sailingID)) != 0) {
+                slots[rows[i].sailing.getSailingID()] = kept.size();
+                kept.push_back(rows[i]);
+            }
+        }
+        rows.swap(kept);
+        rebuildIndexes();
+        
+        return timer.result(file.is_open());
     } catch (const exception& e) {
         cerr << "Exception in deleteSailing: " << e.what() << endl;
-        return false;
+        return timer.result(false);
     }
 }
 
@@ -253,12 +448,10 @@ void sailingFileIO::truncateFile()
 
 Sailing sailingFileIO::getLast()
 {
-    reset();
     Sailing last;
     
-    SailingRecord record;
-    while (file.read(reinterpret_cast<char*>(&record), sizeof(SailingRecord))) {
-        last = binaryRecordToSailing(record);
+    if (!rows.empty()) {
+        last = rows.back().sailing;
     }
     
     return last;
@@ -269,3 +462,194 @@ void sailingFileIO::createFile()
     ofstream f(FILE_NAME, ios::binary);
     f.close();
 }
+
+bool sailingFileIO::matches(const SailingReportRow& row, const SailingQuery& q)
+{
+    string sid = row.sailing.getSailingID();
+    if (!q.terminal.empty() && terminalKey(sid) != q.terminal) {
+        return false;
+    }
+    if (q.day != 0 && dayKey(sid) != twoDigits(q.day)) {
+        return false;
+    }
+    string hour = hourKey(sid);
+    if (hour < twoDigits(q.fromHour) || hour > twoDigits(q.toHour)) {
+        return false;
+    }
+    return q.vessel.empty() || q.vessel == row.sailing.getVesselID();
+}
+
+vector<size_t> sailingFileIO::query(const SailingQuery& q)
+{
+    static LatencyStat &stat = latencyStat("sailingFileIO::query");
+    LatencyTimer timer(stat);
+    vector<size_t> results;
+
+    // Start from the shortest slot list among the indexed filters; the
+    // remaining filters are checked row by row
+    const vector<size_t>* candidates = NULL;
+    vector<size_t> hourSlots;
+    bool indexed = false;
+    const SlotIndex* indexes[] = { &byTerminal, &byDay, &byVessel };
+    string keys[] = { q.terminal, q.day != 0 ? twoDigits(q.day) : "", q.vessel };
+    // Loop goal: Pick the smallest posting list of the equality filters
+    for (int i = 0; i < 3; ++i) {
+        if (keys[i].empty()) {
+            continue;
+        }
+        SlotIndex::const_iterator list = indexes[i]->find(keys[i]);
+        if (list == indexes[i]->end()) {
+            return results; // no sailing has this key
+        }
+        if (!indexed || list->second.size() < candidates->size()) {
+            candidates = &list->second;
+            indexed = true;
+        }
+    }
+    if (q.fromHour > 0 || q.toHour < 23) {
+        SlotIndex::const_iterator first = byHour.lower_bound(twoDigits(q.fromHour));
+        SlotIndex::const_iterator last = byHour.upper_bound(twoDigits(q.toHour));
+        size_t total = 0;
+        // Loop goal: Count the rows departing in the hour range
+        for (SlotIndex::const_iterator it = first; it != last; ++it) {
+            total += it->second.size();
+        }
+        if (!indexed || total < candidates->size()) {
+            // Loop goal: Merge the hour buckets into one ascending list
+            for (SlotIndex::const_iterator it = first; it != last; ++it) {
+                hourSlots.insert(hourSlots.end(), it->second.begin(), it->second.end());
+            }
+            sort(hourSlots.begin(), hourSlots.end());
+            candidates = &hourSlots;
+            indexed = true;
+        }
+    }
+
+    size_t candidateCount = indexed ? candidates->size() : rows.size();
+    size_t limit = q.limit == 0 ? candidateCount : q.limit;
+
+    if (q.order == ORDER_FILE) {
+        // Loop goal: Keep matching rows in file order until the limit is reached
+        for (size_t i = 0; i < candidateCount && results.size() < limit; ++i) {
+            size_t slot = indexed ? (*candidates)[i] : i;
+            if (matches(rows[slot], q)) {
+                results.push_back(slot);
+            }
+        }
+        return results;
+    }
+
+    // ranks 'a' ahead of 'b'; ties keep file order
+    SailingOrder order = q.order;
+    bool descending = q.descending;
+    auto rankedBefore = [order, descending](size_t a, size_t b) {
+        float va, vb;
+        if (order == ORDER_PERCENT_FULL) {
+            va = rows[a].percentFull;
+            vb = rows[b].percentFull;
+        } else if (order == ORDER_LRL) {
+            va = rows[a].sailing.getLRL();
+            vb = rows[b].sailing.getLRL();
+        } else {
+            va = rows[a].sailing.getHRL();
+            vb = rows[b].sailing.getHRL();
+        }
+        if (va != vb) {
+            return descending ? va > vb : va < vb;
+        }
+        return a < b;
+    };
+
+    // max-heap on rank: the top is the worst row kept so far
+    priority_queue<size_t, vector<size_t>, decltype(rankedBefore)> best(rankedBefore);
+    // Loop goal: Keep the best 'limit' matching rows
+    for (size_t i = 0; i < candidateCount; ++i) {
+        size_t slot = indexed ? (*candidates)[i] : i;
+        if (!matches(rows[slot], q)) {
+            continue;
+        }
+        if (best.size() < limit) {
+            best.push(slot);
+        } else if (rankedBefore(slot, best.top())) {
+            best.pop();
+            best.push(slot);
+        }
+    }
+
+    results.resize(best.size());
+    // Loop goal: Drain the heap worst-first into the back of the results
+    for (size_t i = results.size(); i > 0; --i) {
+        results[i - 1] = best.top();
+        best.pop();
+    }
+    return results;
+}
+
+SailingCursor::SailingCursor(size_t pageSize)
+    : rowsPerPage(pageSize == 0 ? 1 : pageSize), page(0)
+{
+}
+
+void SailingCursor::setPageSize(size_t pageSize)
+{
+    size_t firstRow = begin();
+    rowsPerPage = pageSize == 0 ? 1 : pageSize;
+    page = firstRow / rowsPerPage;
+}
+
+size_t SailingCursor::pageSize() const
+{
+    return rowsPerPage;
+}
+
+size_t SailingCursor::pageCount() const
+{
+    size_t count = sailingFileIO::reportRows().size();
+    return count == 0 ? 1 : (count + rowsPerPage - 1) / rowsPerPage;
+}
+
+size_t SailingCursor::currentPage() const
+{
+    // the table may have shrunk since the cursor last moved
+    return min(page, pageCount() - 1);
+}
+
+bool SailingCursor::seekPage(size_t target)
+{
+    if (target >= pageCount()) {
+        return false;
+    }
+    page = target;
+    return true;
+}
+
+bool SailingCursor::next()
+{
+    page = currentPage() + 1;
+    if (page >= pageCount()) {
+        page = 0;
+        return false;
+    }
+    return true;
+}
+
+bool SailingCursor::prev()
+{
+    size_t current = currentPage();
+    if (current == 0) {
+        page = pageCount() - 1;
+        return false;
+    }
+    page = current - 1;
+    return true;
+}
+
+size_t SailingCursor::begin() const
+{
+    return min(currentPage() * rowsPerPage, sailingFileIO::reportRows().size());
+}
+
+size_t SailingCursor::end() const
+{
+    return min(begin() + rowsPerPage, sailingFileIO::reportRows().size());
+}
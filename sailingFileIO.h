@@ -14,6 +14,14 @@
 //          - Finalized format and synced with .cpp logic.
 // Rev. 3 - 2025/08/05 - Nathan Miller
 //          - Fully debugged final release version.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - Sailings are cached in a materialised report table that
+//            is loaded on open and kept current by every save/delete.
+//          - Replaced getNextFive() with SailingCursor paging.
+//          - Added indexed report queries with top-k ranking.
+//          - Added bulkLoad() for generated data.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - openFile() refuses files of an older record layout.
 //************************************************************
 
 #ifndef SAILING_FILE_IO_H
@@ -25,6 +33,45 @@
 #include <iostream>
 #include <string>
 #include <sstream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+//-------------------------------------------------------------------------------------------------
+// one row of the materialised sailing report
+struct SailingReportRow
+{
+    Sailing sailing;     // copy of the saved sailing, including its reservation counters
+    float percentFull;   // capacity percentage, recomputed whenever the sailing is saved
+};
+
+//-------------------------------------------------------------------------------------------------
+// orderings available to report queries
+enum SailingOrder
+{
+    ORDER_FILE,          // order the sailings were saved in
+    ORDER_PERCENT_FULL,  // by capacity percentage
+    ORDER_LRL,           // by remaining low-ceiling lane length
+    ORDER_HRL            // by remaining high-ceiling lane length
+};
+
+//-------------------------------------------------------------------------------------------------
+// filters and ranking for a report query. Sailing IDs are TTT-DD-HH, so the terminal, day
+// and hour are read from the ID. Empty strings and zero values match everything.
+struct SailingQuery
+{
+    std::string terminal;   // departure terminal, e.g. "ABC"
+    int day;                // day of month 1-31, 0 for any
+    int fromHour;           // first departure hour included, 0-23
+    int toHour;             // last departure hour included, 0-23
+    std::string vessel;     // vessel ID
+    SailingOrder order;     // ranking to apply
+    bool descending;        // true to put the largest values first
+    size_t limit;           // most rows to return (top-k), 0 for all
+
+    SailingQuery()
+        : day(0), fromHour(0), toHour(23), order(ORDER_FILE), descending(true), limit(0) {}
+};
 
 //-------------------------------------------------------------------------------------------------
 // class used to read and write the saved sailings in text format
@@ -33,6 +80,27 @@ class sailingFileIO
 private:
     // the file in which sailing data is saved to.
     static std::fstream file;
+    // report table, one row per record in file order
+    static std::vector<SailingReportRow> rows;
+    // sailing ID -> row (and record slot) in the file
+    static std::unordered_map<std::string, size_t> slots;
+    // secondary indexes, each key -> ascending row slots
+    typedef std::map<std::string, std::vector<size_t> > SlotIndex;
+    static SlotIndex byTerminal;
+    static SlotIndex byDay;
+    static SlotIndex byHour;
+    static SlotIndex byVessel;
+    // helper function to add a row's slot to every secondary index
+    static void indexRow(size_t slot);
+    // helper function to rebuild the secondary indexes from the table
+    static void rebuildIndexes();
+    // helper function to test a row against every filter of a query
+    static bool matches(const SailingReportRow& row, const SailingQuery& q);
+    // helper function to load the report table from the file, returns false if the
+    // file does not hold records of the current layout
+    static bool loadTable();
+    // helper function to build a report row for a sailing
+    static SailingReportRow makeRow(const Sailing& s);
     // helper function to create the data file if it does not already exist
     static void createFile();
     // helper function for deleting to get the last one
@@ -51,13 +119,10 @@ public:
     static bool closeFile();
 
     //-----------------------------------------------------------------------------------------
-    // opens the file saved, returns false if it is unable to
+    // opens the file saved, returns false if it is unable to or if the file was written
+    // with an older record layout
     static bool openFile();
 
-    //-----------------------------------------------------------------------------------------
-    // resets the file reading, used when displaying a sailing report
-    static void reset();
-
     //-----------------------------------------------------------------------------------------
     // checks if the passed sailingID is saved in the database, returns true if it is
     static bool exists(
@@ -69,17 +134,88 @@ public:
         const char* sid);
 
     //-----------------------------------------------------------------------------------------
-    // returns up to the next five sailings saved in the database, used for displaying reports.
-    static Sailing *getNextFive();
+    // returns the materialised report table in file order. Rows stay current with every
+    // saveSailing()/deleteSailing(), so reading it never touches the data file.
+    static const std::vector<SailingReportRow>& reportRows();
+
+    //-----------------------------------------------------------------------------------------
+    // runs a report query and returns the matching rows as indexes into reportRows(), in the
+    // requested order. Candidates come from the most selective secondary index and ranked
+    // queries with a limit keep only the best 'limit' rows in a heap.
+    static std::vector<size_t> query(
+        const SailingQuery& q);  // in: filters, ordering and limit
 
     //-----------------------------------------------------------------------------------------
     // enters the specified sailing into the database, returns true if it works.
     // also handles updates when needed
     static bool saveSailing(const Sailing s);
 
+    //-----------------------------------------------------------------------------------------
+    // replaces the sailing file with the given sailings in one write, for loading generated
+    // data. The file must be closed; the table is built from it by the next openFile().
+    // Returns false if the file is open or the write fails.
+    static bool bulkLoad(
+        const std::vector<Sailing>& sailings);  // in: sailings, in file order
+
     //-----------------------------------------------------------------------------------------
     // removes the specified sailing from ID into the database, returns true if it work.
     static bool deleteSailing(const char* sid);
 };
 
+//-------------------------------------------------------------------------------------------------
+// pages through the report table by record slot. Each page is a range of rows in
+// sailingFileIO::reportRows(), so moving to any page is constant time and copies nothing.
+class SailingCursor
+{
+private:
+    // number of rows on each page
+    size_t rowsPerPage;
+    // zero-based index of the current page
+    size_t page;
+
+public:
+    //-----------------------------------------------------------------------------------------
+    // creates a cursor on the first page
+    explicit SailingCursor(
+        size_t pageSize = 5);   // in: rows per page, at least 1
+
+    //-----------------------------------------------------------------------------------------
+    // changes the page size, keeping the first row of the current page in view
+    void setPageSize(
+        size_t pageSize);       // in: rows per page, at least 1
+
+    //-----------------------------------------------------------------------------------------
+    // returns the number of rows per page
+    size_t pageSize() const;
+
+    //-----------------------------------------------------------------------------------------
+    // returns the number of pages in the report (at least 1, even when empty)
+    size_t pageCount() const;
+
+    //-----------------------------------------------------------------------------------------
+    // returns the zero-based index of the current page
+    size_t currentPage() const;
+
+    //-----------------------------------------------------------------------------------------
+    // moves to the given zero-based page, returns false (and stays put) if it is past the end
+    bool seekPage(
+        size_t target);         // in: page to show
+
+    //-----------------------------------------------------------------------------------------
+    // moves to the next page, wrapping to the first after the last. Returns false if it wrapped.
+    bool next();
+
+    //-----------------------------------------------------------------------------------------
+    // moves to the previous page, wrapping to the last before the first. Returns false if it wrapped.
+    bool prev();
+
+    //-----------------------------------------------------------------------------------------
+    // returns the report row index of the first row on the current page
+    size_t begin() const;
+
+    //-----------------------------------------------------------------------------------------
+    // returns one past the report row index of the last row on the current page
+    size_t end() const;
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,684 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the sailing screens declared in sailingMenu.h.
+//   Every prompt and message for sailings lives here; the
+//   Sailing class only validates, saves and formats.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Moved the sailing prompts out of sailing.cpp
+//            unchanged; saves go through the headless Sailing
+//            functions.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - The lane length check on edits moved into
+//            Sailing::applyEdit(), shared with batch and replay.
+//************************************************************
+
+#include "sailingMenu.h"
+#include "sailing.h"
+#include "sailingFileIO.h"
+#include "operationTrace.h"
+#include "ui.h"
+#include <iostream>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <cstdlib>
+#include <cctype>
+
+using namespace std;
+
+// cancel is always 0 so using a constant for it makes sense
+const int CANCEL_OPTION = 0;
+
+namespace {
+
+//--------------------------------------------------
+// prompts until the user enters a whole number in [min, max] or leaves the
+// line blank, in which case 'blankValue' is returned
+int getOptionalInt(const string &prompt, int min, int max, int blankValue)
+{
+    // Loop goal: Keep prompting until the input is blank or a number in range
+    while (true)
+    {
+        string input = UI::getStringInput(prompt, false);
+        if (input.empty())
+            return blankValue;
+        char *end = NULL;
+        long value = strtol(input.c_str(), &end, 10);
+        if (*end == '\0' && value >= min && value <= max)
+            return static_cast<int>(value);
+        cout << "Please enter a number from " << min << " to " << max << ", or leave it blank.\n";
+    }
+}
+
+//--------------------------------------------------
+// prompts for the departure terminal of a sailing
+string addDepTerm()
+{
+    bool validEntry = false;
+    const int DEP_TERM_LENGTH = 3;
+    string depTerm;
+    // Loop goal: Keep prompting until user enters a valid 3-character departure terminal
+    while (!validEntry)
+    {
+        cout << "Format: 3-letter terminal code (e.g., TSA, SWB, HGB)\n";
+        cout << "Enter a departure terminal: ";
+
+        cin >> depTerm;
+
+        // departure terminal is represented by 3 characters
+        if (depTerm.length() != DEP_TERM_LENGTH)
+        {
+            cout << "Invalid departure terminal. Must be exactly 3 characters.\n";
+            cin.clear();
+            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        else
+        {
+            validEntry = true;
+        }
+    }
+    return depTerm;
+}
+
+//--------------------------------------------------
+// prompts for the departure date of a sailing
+string addDate()
+{
+    bool validEntry = false;
+    const int DATE_LENGTH = 2;
+    string date;
+    // Loop goal: Keep prompting until user enters a valid 2-digit date (01-28)
+    while (!validEntry)
+    {
+        cout << "Format: 2-digit day (01-28, e.g., 01, 15, 28)\n";
+        cout << "Enter a departure date: ";
+
+        cin >> date;
+        // date entered should be two digits to represent the date, month is not relevant
+        if (date.length() != DATE_LENGTH || !std::all_of(date.begin(), date.end(), ::isdigit) || stoi(date) < 0 || stoi(date) > 28)
+        {
+            cout << "Invalid departure date. Must be 2 digits between 01-28.\n";
+            cin.clear();
+            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        else
+        {
+            validEntry = true;
+        }
+    }
+    return date;
+}
+
+//--------------------------------------------------
+// prompts for the departure time of a sailing
+string addTime()
+{
+    bool validEntry = false;
+    const int TIME_LENGTH = 2;
+    string time;
+    // Loop goal: Keep prompting until user enters a valid 2-digit time (00-23)
+    while (!validEntry)
+    {
+        cout << "Format: 2-digit hour in 24-hour format (00-23, e.g., 08, 14, 23)\n";
+        cout << "Enter a departure time: ";
+
+        cin >> time;
+        // time entered should be two digits in 24 hour time, can't be below 0 or above 23
+        if (time.length() != TIME_LENGTH || !std::all_of(time.begin(), time.end(), ::isdigit) || stoi(time) < 0 || stoi(time) > 23)
+        {
+            cout << "Invalid departure time. Must be 2 digits between 00-23.\n";
+            cin.clear();
+            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        else
+        {
+            validEntry = true;
+        }
+    }
+    return time;
+}
+
+//--------------------------------------------------
+// prompts for the vessel ID of a sailing
+string addVessel()
+{
+    bool validEntry = false;
+    string vessel;
+    // Loop goal: Keep prompting until user enters a valid vessel ID (1-25 characters)
+    while (!validEntry)
+    {
+        cout << "\nVessel ID/Name:\n";
+        cout << "Format: Vessel name or identifier\n";
+        cout << "Guidelines:\n";
+        cout << "  - 1-25 characters maximum\n";
+        cout << "  - Can be name or alphanumeric ID\n";
+        cout << "  - No spaces (use underscore if needed)\n";
+        cout << "  - Examples: CoastalRunner, Island_Voyager, FERRY123, Vessel_01\n";
+        cout << "Enter a vessel ID: ";
+
+        cin >> vessel;
+        // vesselID can be between 1 and 25 characters
+        if (vessel.length() > VESSEL_ID_MAX || vessel.length() == 0)
+        {
+            cout << "Invalid vessel ID. Must be 1-25 characters long.\n";
+            cin.clear();
+            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        else
+        {
+            validEntry = true;
+        }
+    }
+    return vessel;
+}
+
+//--------------------------------------------------
+// prompts for the low car length limit of a sailing
+int addLCLL()
+{
+    bool validEntry = false;
+    int lcll;
+
+    // Loop goal: Keep prompting until user enters a valid LCLL value (0-9999)
+    while (!validEntry)
+    {
+        cout << "\nLow Car Length Limit (LCLL):\n";
+        cout << "Format: Maximum length for regular vehicles in meters\n";
+        cout << "Guidelines:\n";
+        cout << "  - Enter as whole number (0-9999)\n";
+        cout << "  - Represents maximum length capacity for regular vehicles\n";
+        cout << "  - Common values: 100, 150, 200, 300, 500\n";
+        cout << "  - Examples: 111 (111 meters), 200 (200 meters)\n";
+        cout << "Enter LCLL: ";
+        cin >> lcll;
+
+        // reprompts user if entered value is not a float or too big/small.
+        // value is converted to DDDD.D form when saved.
+        if (cin.fail() || lcll > LANE_LIMIT_MAX || lcll < 0)
+        {
+            cout << "Invalid LCLL. Must be a number between 0-9999.\n";
+            cin.clear();
+            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        else
+        {
+            validEntry = true;
+        }
+    }
+    return lcll;
+}
+
+//--------------------------------------------------
+// prompts for the high clearance lane limit of a sailing
+int addHCLL()
+{
+    bool validEntry = false;
+    int hcll;
+
+    // Loop goal: Keep prompting until user enters a valid HCLL value (0-9999)
+    while (!validEntry)
+    {
+        cout << "\nHigh Clearance Lane Limit (HCLL):\n";
+        cout << "Format: Maximum length for special vehicles in meters\n";
+        cout << "Guidelines:\n";
+        cout << "  - Enter as whole number (0-9999)\n";
+        cout << "  - Represents maximum length capacity for special/oversized vehicles\n";
+        cout << "  - Usually higher than LCLL\n";
+        cout << "  - Common values: 200, 300, 500, 1000\n";
+        cout << "  - Examples: 222 (222 meters), 300 (300 meters)\n";
+        cout << "Enter HCLL: ";
+        cin >> hcll;
+
+        // reprompts user if entered value is not a float or too big/small.
+        // value is converted to DDDD.D form when saved.
+        if (cin.fail() || hcll > LANE_LIMIT_MAX || hcll < 0)
+        {
+            cout << "Invalid HCLL. Must be a number between 0-9999.\n";
+            cin.clear();
+            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        else
+        {
+            validEntry = true;
+        }
+    }
+    return hcll;
+}
+
+//--------------------------------------------------
+// prompts the user to confirm the operation they are doing
+bool confirm(int confirmOption)
+{
+    // Loop goal: Keep prompting until user enters valid confirmation choice (cancel or confirm)
+    while (true)
+    {
+        int input;
+        cout << "\n[" << CANCEL_OPTION << "] Cancel\n";
+        cout << "[" << confirmOption << "] Confirm\n\n";
+        cout << "Enter an option: ";
+        cin >> input;
+        if (cin.fail() || (input != CANCEL_OPTION && input != confirmOption))
+        {
+            cout << "Invalid option.\n";
+            cin.clear();
+            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        }
+        else if (input == CANCEL_OPTION)
+        {
+            return false;
+        }
+        else
+        {
+            return true;
+        }
+    }
+    return true;
+}
+
+//--------------------------------------------------
+// replaces 'count' characters of a sailing ID starting at 'pos' and reports
+// whether the new ID is still free
+bool replaceIDPart(char *sid, size_t pos, const string &part, size_t count)
+{
+    // Loop goal: Copy each replaced character into the sailing ID
+    for (size_t i = 0; i < count && i < part.size(); i++)
+    {
+        sid[pos + i] = part[i];
+    }
+    if (sailingFileIO::exists(sid))
+    {
+        cout << "Sailing with ID " << sid << " already exists.\n";
+        return false;
+    }
+    return true;
+}
+
+} // end anonymous namespace
+
+bool SailingMenu::addSailing()
+{
+    const char SID_SEPARATOR = '-';
+    const int CONFIRM_OPTION = 1;
+
+    // uses helper functions to prompt the user for and create the sailing id
+    UI::displayHeader("Add Sailing");
+    string depTerm = addDepTerm();
+    string date = addDate();
+    string time = addTime();
+
+    // forms the sailing id according to the ord, converts to char array
+    string sidString = depTerm + SID_SEPARATOR + date + SID_SEPARATOR + time;
+    char sid[10];
+
+    strncpy(sid, sidString.c_str(), sizeof(sid) - 1);
+    sid[sizeof(sid) - 1] = '\0';
+
+    // aborts the process if the sailing already exists
+    if (sailingFileIO::exists(sid))
+    {
+        cout << "Sailing with ID " << sid << " already exists.\n";
+        return false;
+    }
+
+    // uses helper functions to prompt the user for the rest of the sailing information.
+    string vessel = addVessel();
+    int lcll = addLCLL();
+    int hcll = addHCLL();
+
+    // displays the sailing information before prompting the user to confirm
+    cout << "\nDeparture Terminal: " << depTerm << "\n";
+    cout << "Departure Date: " << date << "\n";
+    cout << "Departure Time: " << time << "\n";
+    cout << "Vessel ID: " << vessel << "\n";
+    cout << "LCLL: " << lcll << "\n";
+    cout << "HCLL: " << hcll << "\n";
+
+    // confirms the entry, cancels if cancelled
+    if (!confirm(CONFIRM_OPTION))
+    {
+        // aborts this operation and hands control back to ui.cpp
+        return false;
+    }
+
+    bool saved;
+    {
+        TraceScope trace("addSailing");
+        trace.arg(sid).arg(vessel).arg(lcll).arg(hcll);
+        saved = Sailing::addSailing(sid, vessel, lcll, hcll);
+    }
+    if (saved)
+    {
+        cout << "Sailing Successfully Added. Returning to the main menu.\n";
+        UI::displayFooter();
+        return true;
+    }
+
+    cout << "Error: Unable to add sailing.\n";
+    // if it fails to save, returns false to the UI
+    UI::displayFooter();
+    return false;
+}
+
+void SailingMenu::editSailing(const char *sailingID)
+{
+    if (!sailingFileIO::exists(sailingID))
+    {
+        cout << "Sailing with ID " << sailingID << " does not exist.\n";
+        return;
+    }
+
+    // the edits are made to a copy and only saved on confirm
+    Sailing saved = Sailing::getSailingFromIO(sailingID);
+    char sid[10];
+    strncpy(sid, saved.getSailingID(), sizeof(sid) - 1);
+    sid[sizeof(sid) - 1] = '\0';
+    string vessel = saved.getVesselID();
+    int lcll = saved.getLCLL();
+    int hcll = saved.getHCLL();
+    float lrl = saved.getLRL();
+    float hrl = saved.getHRL();
+
+    // Validate that this sailing has valid data before proceeding
+    if (strlen(sid) == 0) {
+        UI::displayHeader("Edit Sailing");
+        cout << "Error: Invalid sailing data. Cannot edit this sailing.\n";
+        UI::displayFooter();
+        return;
+    }
+
+    bool editing = true;
+    int input;
+    // runs the editing loop until either confirm, cancel, delete, or manage reservations is chosen
+    // Loop goal: Continue editing sailing details until user chooses to confirm, cancel, delete, or manage reservations
+    while (editing)
+    {
+        // used to keep track of order and options
+        enum editSailingOptions
+        {
+            DEP_TERM = 1,
+            DEP_DAY,
+            DEP_TIME,
+            VESSEL_ID,
+            LCLL,
+            HCLL,
+            NUM_OF_OPTIONS = 6
+        };
+
+        string sidText = sid;
+
+        // Additional validation: check if sailing ID has proper format
+        if (sidText.length() < 7 || sidText.find('-') == string::npos) {
+            UI::displayHeader("Edit Sailing");
+            cout << "Error: Invalid sailing ID format. Cannot edit this sailing.\n";
+            UI::displayFooter();
+            return;
+        }
+
+        UI::displayHeader("Edit Sailing");
+        // Loop goal: Display all editing options in order (1 through NUM_OF_OPTIONS)
+        for (int i = 1; i <= NUM_OF_OPTIONS; i++)
+        {
+            switch (i)
+            {
+            case DEP_TERM:
+                if (sidText.length() >= 3) {
+                    cout << "[" << i << "] " << "Departure Terminal: " << sidText.substr(0, 3) << "\n";
+                } else {
+                    cout << "[" << i << "] " << "Departure Terminal: [Invalid]\n";
+                }
+                break;
+
+            case DEP_DAY:
+                if (sidText.length() >= 6) {
+                    cout << "[" << i << "] " << "Departure Day: " << sidText.substr(4, 2) << "\n";
+                } else {
+                    cout << "[" << i << "] " << "Departure Day: [Invalid]\n";
+                }
+                break;
+
+            case DEP_TIME:
+                if (sidText.length() >= 9) {
+                    cout << "[" << i << "] " << "Departure Time: " << sidText.substr(7, 2) << "\n";
+                } else {
+                    cout << "[" << i << "] " << "Departure Time: [Invalid]\n";
+                }
+                break;
+
+            case VESSEL_ID:
+                cout << "[" << i << "] " << "Vessel ID: " << vessel << "\n";
+                break;
+
+            case LCLL:
+                cout << "[" << i << "] " << "LCLL: " << lcll << "\n";
+                break;
+
+            case HCLL:
+                cout << "[" << i << "] " << "HCLL: " << hcll << "\n";
+                break;
+            }
+        }
+
+        // after two new lines, prints the options that aren't directly tied to editing the sailing.
+        const int CONFIRM_OPTION = 7;
+        const int RESERVATIONS_OPTION = 8;
+        const int DELETE_OPTION = 9;
+
+        cout << "\n[" << CANCEL_OPTION << "] Cancel\n";
+        cout << "[" << CONFIRM_OPTION << "] Confirm\n";
+        cout << "[" << RESERVATIONS_OPTION << "] Manage Reservations\n";
+        cout << "[" << DELETE_OPTION << "] Delete Sailing\n";
+
+        // prompts the user for input until they enter something valid.
+        cout << "\nEnter an Option: ";
+        cin >> input;
+        if (cin.fail() || input < CANCEL_OPTION || input > DELETE_OPTION)
+        {
+            cout << "Please enter a valid option.\n";
+            cin.clear();
+            cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            UI::displayFooter();
+            continue; // Go back to the beginning of the loop
+        }
+
+        switch (input)
+        {
+        // returns control to UI if cancelled
+        case CANCEL_OPTION:
+            cout << "Changes Reverted. Returning to the main menu.\n";
+            return;
+        // a new terminal, day or time is rejected if that sailing ID already exists
+        case DEP_TERM:
+            if (!replaceIDPart(sid, 0, addDepTerm(), 3))
+                return;
+            break;
+        case DEP_DAY:
+            if (!replaceIDPart(sid, 4, addDate(), 2))
+                return;
+            break;
+        case DEP_TIME:
+            if (!replaceIDPart(sid, 7, addTime(), 2))
+                return;
+            break;
+        case VESSEL_ID:
+            vessel = addVessel();
+            break;
+        // the space already taken stays taken; applyEdit() rejects limits the current
+        // reservations don't fit in when the edit is confirmed
+        case LCLL:
+        {
+            int newLCLL = addLCLL();
+            lrl = newLCLL - (lcll - lrl);
+            lcll = newLCLL;
+            break;
+        }
+        case HCLL:
+        {
+            int newHCLL = addHCLL();
+            hrl = newHCLL - (hcll - hrl);
+            hcll = newHCLL;
+            break;
+        }
+        case CONFIRM_OPTION:
+        {
+            editing = false;
+            bool applied;
+            {
+                TraceScope trace("editSailing");
+                trace.arg(sailingID).arg(sid).arg(vessel).arg(lcll).arg(hcll);
+                applied = Sailing::applyEdit(sailingID, sid, vessel, lcll, hcll);
+            }
+            if (!applied)
+            {
+                cout << "Error: The new sailing cannot hold the existing reservations. Changes Reverted.\n";
+                break;
+            }
+
+            cout << "Changes Successfully Saved. Returning to the main menu.\n";
+            break;
+        }
+        // opens manage reservations for this sailing, requires reservation class
+        case RESERVATIONS_OPTION:
+            UI::manageReservationsForSailing(sid);
+            break;
+        case DELETE_OPTION:
+        {
+            editing = false;
+            // deletes the sailing as saved on file, along with all of its reservations
+            int cancelled;
+            {
+                TraceScope trace("deleteSailing");
+                trace.arg(sailingID);
+                cancelled = Sailing::deleteWithReservations(sailingID);
+            }
+            if (cancelled >= 0)
+            {
+                cout << "Sailing Successfully Deleted";
+                if (cancelled > 0)
+                {
+                    cout << " with " << cancelled << " reservation(s)";
+                }
+                cout << ". Returning to the main menu.\n";
+            }
+            break;
+        }
+        }
+        UI::displayFooter();
+    }
+}
+
+void SailingMenu::displayReport()
+{
+    // initializes variables required for the for loop
+    bool reportActive = true;
+    const int PREV_OPTION = 4;
+    const int NEXT_OPTION = 5;
+    const int GOTO_OPTION = 6;
+
+    // the report table is kept current by every save, so pages come straight from memory
+    SailingCursor cursor(REPORT_PAGE_SIZE);
+
+    // Loop goal: Continue displaying sailing reports until user chooses to exit
+    while (reportActive)
+    {
+        UI::displayHeader("Sailing Report");
+
+        {
+            TraceScope trace("displayReport");
+            trace.arg(cursor.currentPage());
+            Sailing::writeReportPage(cout, cursor);
+        }
+
+        // prompts the user to enter an option, continues until valid input is received
+        // past the last page the user loops back to the first with '5', and the other way with '4'
+        cout << "\n[0] Cancel\n[4] Show previous 5\n[5] Show next 5\n[6] Go to page\n\nEnter an option: ";
+        int input;
+        bool validInput = false;
+        // Loop goal: Keep prompting until user enters a valid option (0, 4, 5 or 6)
+        while (!validInput)
+        {
+            cin >> input;
+            if (cin.fail() || (input != CANCEL_OPTION && input != PREV_OPTION &&
+                               input != NEXT_OPTION && input != GOTO_OPTION))
+            {
+                if (cin.eof())
+                    return;
+                cout << "Invalid option, please enter an option: ";
+                cin.clear();
+                cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            }
+            else
+            {
+                validInput = true;
+                if (input == CANCEL_OPTION)
+                    reportActive = false;
+                else if (input == PREV_OPTION)
+                    cursor.prev();
+                else if (input == NEXT_OPTION)
+                    cursor.next();
+                else
+                {
+                    cout << "Enter a page number (1-" << cursor.pageCount() << "): ";
+                    size_t target;
+                    // Loop goal: Keep prompting until a page in range is entered
+                    while (!(cin >> target) || target == 0 || !cursor.seekPage(target - 1))
+                    {
+                        if (cin.eof())
+                            return;
+                        cout << "Invalid page, please enter a page number: ";
+                        cin.clear();
+                        cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                    }
+                }
+            }
+        }
+        UI::displayFooter();
+    }
+}
+
+void SailingMenu::displayQueryReport()
+{
+    UI::displayHeader("Query Sailings");
+    cout << "[0] Cancel\n\n";
+    cout << "Leave a filter blank to match every sailing.\n";
+
+    SailingQuery q;
+    string terminal = UI::getStringInput("Departure terminal (e.g., ABC): ");
+    if (terminal == "CANCEL")
+        return;
+    // Loop goal: Upper-case the terminal code to match saved sailing IDs
+    for (size_t i = 0; i < terminal.size(); i++)
+        terminal[i] = static_cast<char>(toupper(static_cast<unsigned char>(terminal[i])));
+    q.terminal = terminal;
+    q.day = getOptionalInt("Day of month (1-31): ", 1, 31, 0);
+    q.fromHour = getOptionalInt("Earliest departure hour (0-23): ", 0, 23, 0);
+    q.toHour = getOptionalInt("Latest departure hour (0-23): ", q.fromHour, 23, 23);
+    q.vessel = UI::getStringInput("Vessel ID: ", false);
+
+    cout << "\n[1] File order\n[2] Percent full\n[3] LRL\n[4] HRL\n\nOrder by: ";
+    int orderChoice = UI::getValidIntInput(1, 4);
+    if (orderChoice == CANCEL_OPTION)
+        return; // end of input
+    const SailingOrder ORDERS[] = { ORDER_FILE, ORDER_PERCENT_FULL, ORDER_LRL, ORDER_HRL };
+    q.order = ORDERS[orderChoice - 1];
+    if (q.order != ORDER_FILE)
+    {
+        cout << "[1] Highest first\n[2] Lowest first\n\nDirection: ";
+        q.descending = UI::getValidIntInput(1, 2) == 1;
+    }
+    q.limit = static_cast<size_t>(getOptionalInt("Number of sailings to show: ", 1, 100000, 0));
+    UI::displayFooter();
+
+    UI::displayHeader("Query Results");
+    {
+        TraceScope trace("queryReport");
+        trace.arg(q.terminal).arg(q.day).arg(q.fromHour).arg(q.toHour).arg(q.vessel)
+             .arg(static_cast<int>(q.order)).arg(q.descending).arg(q.limit);
+        Sailing::writeQueryResults(cout, q);
+    }
+    UI::displayFooter();
+}
@@ -0,0 +1,51 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the console screens for sailings: Add Sailing,
+//   Edit Sailing, the paged Sailing Report and Query Sailings.
+//   They prompt on cin/cout and call the headless Sailing
+//   functions in libfrss to do the work.
+//************************************************************
+// USAGE:
+// - Part of the console front end; called from the UI menus.
+// - The sailing module must be initialized first.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Moved the sailing prompts out of sailing.cpp.
+//************************************************************
+// in: Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef SAILING_MENU_H
+#define SAILING_MENU_H
+
+namespace SailingMenu {
+
+    // addSailing
+    // Prompts for a new sailing, confirms it and saves it.
+    // out: bool - true if the sailing was added, false if cancelled or rejected
+    bool addSailing();
+
+    // editSailing
+    // Shows a sailing and lets the user edit, delete or manage its reservations.
+    // in: sailingID - the sailing to edit
+    // out: none
+    void editSailing(const char *sailingID);
+
+    // displayReport
+    // Shows the sailing report a page at a time until the user cancels.
+    // out: none
+    void displayReport();
+
+    // displayQueryReport
+    // Prompts for filters and a ranking, then shows the matching sailings.
+    // out: none
+    void displayQueryReport();
+
+}
+
+#endif // SAILING_MENU_H
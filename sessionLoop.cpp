@@ -0,0 +1,138 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the event loop and store executor declared in
+//   sessionLoop.h. Built with -std=c++20.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial event loop and store executor.
+//************************************************************
+
+#include "sessionLoop.h"
+
+void SessionTask::promise_type::return_void()
+{
+    if (loop != nullptr)
+        loop->finished();
+}
+
+SessionTask::~SessionTask()
+{
+    // A task never spawned still owns its suspended frame
+    if (handle)
+        handle.destroy();
+}
+
+void EventLoop::spawn(SessionTask task)
+{
+    std::coroutine_handle<SessionTask::promise_type> handle = std::exchange(task.handle, nullptr);
+    handle.promise().loop = this;
+    ++live;
+    post(handle);
+}
+
+void EventLoop::post(std::coroutine_handle<> handle)
+{
+    {
+        std::lock_guard<std::mutex> hold(lock);
+        ready.push_back(handle);
+    }
+    wake.notify_one();
+}
+
+void EventLoop::addTimer(std::chrono::steady_clock::time_point when, std::coroutine_handle<> h)
+{
+    timers.push(Timer(when, h));
+    if (timers.size() > peak)
+        peak = timers.size();
+}
+
+void EventLoop::finished()
+{
+    --live;
+}
+
+void EventLoop::run()
+{
+    typedef std::chrono::steady_clock Clock;
+    std::deque<std::coroutine_handle<> > batch;
+    // Loop goal: Resume ready and woken sessions until none are left
+    while (live > 0)
+    {
+        // Loop goal: Move each session whose sleep is over to the batch
+        while (!timers.empty() && timers.top().first <= Clock::now())
+        {
+            batch.push_back(timers.top().second);
+            timers.pop();
+        }
+        {
+            std::unique_lock<std::mutex> hold(lock);
+            if (batch.empty() && ready.empty())
+            {
+                // Nothing to do until a store call finishes or a timer is due
+                if (timers.empty())
+                    wake.wait(hold, [this] { return !ready.empty(); });
+                else
+                    wake.wait_until(hold, timers.top().first, [this] { return !ready.empty(); });
+            }
+            batch.insert(batch.end(), ready.begin(), ready.end());
+            ready.clear();
+        }
+        // Loop goal: Run each session until it next suspends
+        for (std::coroutine_handle<> handle : batch)
+            handle.resume();
+        batch.clear();
+    }
+}
+
+StoreExecutor::StoreExecutor()
+    : worker(&StoreExecutor::work, this)
+{
+}
+
+StoreExecutor::~StoreExecutor()
+{
+    stop();
+}
+
+void StoreExecutor::submit(std::function<void()> job)
+{
+    {
+        std::lock_guard<std::mutex> hold(lock);
+        jobs.push_back(std::move(job));
+    }
+    wake.notify_one();
+}
+
+void StoreExecutor::stop()
+{
+    {
+        std::lock_guard<std::mutex> hold(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    if (worker.joinable())
+        worker.join();
+}
+
+void StoreExecutor::work()
+{
+    // Loop goal: Run each job in the order it was submitted
+    for (;;)
+    {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> hold(lock);
+            wake.wait(hold, [this] { return stopping || !jobs.empty(); });
+            if (jobs.empty())
+                return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        job();
+        ++done;
+    }
+}
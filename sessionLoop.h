@@ -0,0 +1,274 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the C++20 coroutine session layer: many kiosk and
+//   agent sessions run as coroutines on one event loop thread,
+//   and their store operations are co_await-ed instead of
+//   blocking the thread. A session waiting for its next input
+//   costs one suspended coroutine frame, not a thread.
+//
+//   The stores keep one process-wide file each and are not
+//   re-entrant, so every store call runs on one store thread
+//   (StoreExecutor), in the order the calls were made. Each
+//   session reaches it through its own StoreHandle, which keeps
+//   the session's output and counts apart from the others.
+//************************************************************
+// USAGE:
+// - Opt-in: built with -std=c++20 by 'make sessions' only; the
+//   rest of the system stays C++11.
+// - Initialize the stores, create an EventLoop and a
+//   StoreExecutor, spawn() one SessionTask per session and call
+//   run(). Inside a session:
+//       StoreHandle &store = ...;
+//       bool ok = co_await store.command("checkin ABC-01-09 BC1234");
+//       co_await loop.sleepFor(std::chrono::milliseconds(50));
+//       float fare = co_await store.call([] { return checkIn(...); });
+// - Shut the executor down (stop()) before the stores.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial event loop, store executor and awaitable
+//            store calls.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef SESSION_LOOP_H
+#define SESSION_LOOP_H
+
+#include "batchCommands.h"
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+class EventLoop;
+
+//--------------------------------------------------
+// Coroutine type of one session. It starts when spawned on an
+// EventLoop and frees its frame when it finishes.
+class SessionTask
+{
+public:
+    struct promise_type
+    {
+        EventLoop *loop = nullptr;
+
+        SessionTask get_return_object()
+        {
+            return SessionTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void();
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    SessionTask(SessionTask &&other) noexcept
+        : handle(std::exchange(other.handle, nullptr)) {}
+    ~SessionTask();
+
+private:
+    friend class EventLoop;
+    explicit SessionTask(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+    std::coroutine_handle<promise_type> handle;
+
+    SessionTask(const SessionTask &) = delete;
+    SessionTask &operator=(const SessionTask &) = delete;
+};
+
+//--------------------------------------------------
+// Runs sessions on the calling thread: resumes coroutines that
+// are ready, and wakes sleeping ones when their time is up.
+// post() may be called from any thread.
+class EventLoop
+{
+public:
+    // Starts a session on the next run().
+    void spawn(
+        SessionTask task // in: session to run
+    );
+
+    // Queues a suspended coroutine to be resumed on the loop.
+    void post(
+        std::coroutine_handle<> handle // in: coroutine to resume
+    );
+
+    // Runs until every spawned session has finished.
+    void run();
+
+    // Awaitable that suspends the session for 'delay', e.g. while
+    // it waits for a customer's next input.
+    auto sleepFor(std::chrono::steady_clock::duration delay)
+    {
+        struct Sleep
+        {
+            EventLoop &loop;
+            std::chrono::steady_clock::time_point wake;
+            bool await_ready() const { return false; }
+            void await_suspend(std::coroutine_handle<> h) { loop.addTimer(wake, h); }
+            void await_resume() const {}
+        };
+        return Sleep{*this, std::chrono::steady_clock::now() + delay};
+    }
+
+    // Returns the most sessions that were sleeping at once.
+    size_t peakSleeping() const
+    {
+        return peak;
+    }
+
+private:
+    friend struct SessionTask::promise_type;
+
+    typedef std::pair<std::chrono::steady_clock::time_point, std::coroutine_handle<> > Timer;
+    struct Later
+    {
+        bool operator()(const Timer &a, const Timer &b) const { return a.first > b.first; }
+    };
+
+    std::mutex lock;                     // guards ready
+    std::condition_variable wake;        // signalled by post()
+    std::deque<std::coroutine_handle<> > ready;
+    // The rest is only used on the loop thread
+    std::priority_queue<Timer, std::vector<Timer>, Later> timers;
+    size_t live = 0;                     // sessions not yet finished
+    size_t peak = 0;                     // most sessions sleeping at once
+
+    void addTimer(std::chrono::steady_clock::time_point when, std::coroutine_handle<> h);
+    void finished();
+};
+
+//--------------------------------------------------
+// The one thread that calls the stores. Jobs run one at a time,
+// first in, first out.
+class StoreExecutor
+{
+public:
+    StoreExecutor();
+    ~StoreExecutor();
+
+    // Queues a job.
+    void submit(
+        std::function<void()> job // in: store work to run
+    );
+
+    // Runs the queued jobs and stops the thread.
+    void stop();
+
+    // Returns the number of jobs run.
+    size_t jobsRun() const
+    {
+        return done;
+    }
+
+private:
+    std::mutex lock;
+    std::condition_variable wake;
+    std::deque<std::function<void()> > jobs;
+    bool stopping = false;
+    size_t done = 0;
+    std::thread worker;
+
+    void work();
+};
+
+//--------------------------------------------------
+// One session's handle on the stores. Every call is run on the
+// executor and resumes the session on its loop with the result.
+class StoreHandle
+{
+public:
+    StoreHandle(
+        EventLoop &loop,         // in: loop the session runs on
+        StoreExecutor &executor, // in: store thread
+        size_t id                // in: session number
+    )
+        : loop(loop), executor(executor), id(id) {}
+
+    // Awaitable that runs 'job' on the store thread and returns
+    // its result to the session.
+    template <typename Job>
+    auto call(Job job)
+    {
+        typedef decltype(job()) Result;
+        struct Call
+        {
+            StoreHandle &handle;
+            Job job;
+            Result result{};
+            bool await_ready() const { return false; }
+            void await_suspend(std::coroutine_handle<> h)
+            {
+                handle.executor.submit([this, h]
+                {
+                    result = job();
+                    handle.loop.post(h);
+                });
+            }
+            Result await_resume() { return std::move(result); }
+        };
+        ++calls;
+        return Call{*this, std::move(job)};
+    }
+
+    // Awaitable that runs one batch command (batchCommands.h) and
+    // keeps its result lines in this session's output. Returns
+    // true if the command succeeded.
+    auto command(const std::string &line)
+    {
+        return call([this, line]
+        {
+            bool ok = runCommand(line, results);
+            if (!ok)
+                ++failures;
+            return ok;
+        });
+    }
+
+    // Returns the session number.
+    size_t session() const
+    {
+        return id;
+    }
+
+    // Returns the result lines written so far.
+    std::string output() const
+    {
+        return results.str();
+    }
+
+    // Returns the store calls and failed commands so far.
+    size_t callCount() const
+    {
+        return calls;
+    }
+    size_t failureCount() const
+    {
+        return failures;
+    }
+
+private:
+    EventLoop &loop;
+    StoreExecutor &executor;
+    size_t id;
+    std::ostringstream results; // written on the store thread only
+    size_t calls = 0;
+    size_t failures = 0;        // written on the store thread only
+};
+
+#endif // SESSION_LOOP_H
@@ -0,0 +1,178 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Runs many concurrent sessions on the coroutine session layer
+//   (sessionLoop.h). Each session plays a script of batch
+//   commands, waiting a "think time" before each one as a kiosk
+//   customer or agent would; all sessions share one event loop
+//   thread and one store thread.
+//************************************************************
+// USAGE:
+// - make sessions           (opt-in C++20 build)
+// - ./ferry_sessions [--sessions N] [--think-ms MS] [--output] SCRIPT
+//     N       sessions to run at once (default 1000)
+//     MS      wait before each command (default 20)
+//     SCRIPT  batch commands (see batchCommands.h); "{session}"
+//             in a line is replaced by the session number, so
+//             each session can book its own plate
+//     --output  print every session's result lines, prefixed
+//             with the session number
+// Prints sessions, commands, failures, wall time and the most
+// sessions waiting at once. Exits with 0 if every command
+// succeeded, 2 if any failed and 1 on bad usage.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial concurrent session driver.
+//************************************************************
+
+#include "sessionLoop.h"
+#include "ui.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------
+// Function: forSession
+//--------------------------------------------------
+// Returns 'line' with each "{session}" replaced by 'id'.
+static std::string forSession(std::string line, size_t id)
+{
+    static const std::string TOKEN = "{session}";
+    std::string number = std::to_string(id);
+    size_t at = line.find(TOKEN);
+    // Loop goal: Replace each occurrence of the token
+    while (at != std::string::npos)
+    {
+        line.replace(at, TOKEN.size(), number);
+        at = line.find(TOKEN, at + number.size());
+    }
+    return line;
+}
+
+//--------------------------------------------------
+// Function: runSession
+//--------------------------------------------------
+// One session: waits the think time, then runs the next command
+// of the script, until the script ends.
+static SessionTask runSession(EventLoop &loop, StoreHandle &store,
+                              const std::vector<std::string> &script,
+                              std::chrono::milliseconds think)
+{
+    // Loop goal: Play each script line in turn
+    for (const std::string &line : script)
+    {
+        co_await loop.sleepFor(think);
+        co_await store.command(forSession(line, store.session()));
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    size_t sessions = 1000;
+    long thinkMs = 20;
+    bool output = false;
+    const char *scriptFile = NULL;
+    bool badUsage = false;
+    // Loop goal: Read each option and the script name
+    for (int i = 1; i < argc; ++i)
+    {
+        char *end = NULL;
+        if (std::strcmp(argv[i], "--sessions") == 0 && i + 1 < argc)
+        {
+            long value = std::strtol(argv[++i], &end, 10);
+            badUsage = badUsage || *end != '\0' || value <= 0;
+            sessions = static_cast<size_t>(value);
+        }
+        else if (std::strcmp(argv[i], "--think-ms") == 0 && i + 1 < argc)
+        {
+            thinkMs = std::strtol(argv[++i], &end, 10);
+            badUsage = badUsage || *end != '\0' || thinkMs < 0;
+        }
+        else if (std::strcmp(argv[i], "--output") == 0)
+            output = true;
+        else if (scriptFile == NULL && argv[i][0] != '-')
+            scriptFile = argv[i];
+        else
+            badUsage = true;
+    }
+    if (badUsage || scriptFile == NULL)
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--sessions N] [--think-ms MS] [--output] SCRIPT\n";
+        return 1;
+    }
+
+    std::ifstream file(scriptFile);
+    if (!file.is_open())
+    {
+        std::cerr << "Unable to read script " << scriptFile << ".\n";
+        return 1;
+    }
+    std::vector<std::string> script;
+    std::string line;
+    // Loop goal: Keep each command line of the script
+    while (std::getline(file, line))
+    {
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start != std::string::npos && line[start] != '#')
+            script.push_back(line);
+    }
+
+    // The start-up and shutdown messages would mix with the results
+    std::streambuf *console = std::cout.rdbuf();
+    std::cout.rdbuf(NULL);
+    bool started = UI::initialize();
+    std::cout.rdbuf(console);
+    if (!started)
+    {
+        std::cerr << "Initialization failed. Exiting program.\n";
+        return 1;
+    }
+
+    EventLoop loop;
+    StoreExecutor executor;
+    std::vector<std::unique_ptr<StoreHandle> > handles;
+    handles.reserve(sessions);
+    // Loop goal: Give each session its store handle and start it
+    for (size_t id = 1; id <= sessions; ++id)
+    {
+        handles.emplace_back(new StoreHandle(loop, executor, id));
+        loop.spawn(runSession(loop, *handles.back(), script, std::chrono::milliseconds(thinkMs)));
+    }
+
+    std::chrono::steady_clock::time_point begun = std::chrono::steady_clock::now();
+    loop.run();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begun).count();
+    executor.stop();
+
+    size_t commands = 0;
+    size_t failed = 0;
+    // Loop goal: Add up each session's counts, printing its results if asked
+    for (const auto &handle : handles)
+    {
+        commands += handle->callCount();
+        failed += handle->failureCount();
+        if (!output)
+            continue;
+        std::istringstream results(handle->output());
+        // Loop goal: Print each result line with the session number
+        while (std::getline(results, line))
+            std::cout << handle->session() << '\t' << line << '\n';
+    }
+
+    std::cout.rdbuf(NULL);
+    UI::shutdown();
+    std::cout.rdbuf(console);
+
+    std::cout << "sessions " << sessions << ", commands " << commands << ", failed " << failed
+              << ", " << seconds << " s, " << (seconds > 0.0 ? commands / seconds : 0.0)
+              << " commands/s, at most " << loop.peakSleeping() << " sessions waiting at once\n";
+    return failed == 0 ? 0 : 2;
+}
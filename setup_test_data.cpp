@@ -3,6 +3,11 @@
 // PURPOSE: Pre-loads the system with demo data as specified by Russ
 // Creates vessels, sailings, vehicles, and reservations for testing
 //************************************************************
+// USAGE:
+// - ./setup_demo                 creates the demo data below.
+// - ./setup_demo --sailings N ... generates a synthetic dataset
+//   instead (see printUsage() for the options).
+//************************************************************
 
 #include "sailing.h"
 #include "vehicle.h"
@@ -10,6 +15,13 @@
 #include "sailingFileIO.h"
 #include "vehicleFileIO.h"
 #include "reservationFileIO.h"
+#include "workloadGenerator.h"
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <cstring>
 #include <fstream>
@@ -25,6 +37,7 @@ void clearExistingData() {
     remove("sailingData.dat");  // Binary format
     remove("vehicles.dat");     // Binary format
     remove("reservation.dat");  // Binary format
+    remove("phoneIndex.dat");   // Binary format
     
     cout << "✓ All existing data cleared.\n\n";
 }
@@ -82,7 +95,144 @@ bool createSailingDirect(const char* sailingID, const char* vesselName, int lcll
     }
 }
 
-int main() {
+// Prints the generator options
+void printUsage() {
+    cout << "Usage: setup_demo [options]\n"
+         << "  (no options)          create the demo data\n"
+         << "  --seed N              random seed (same seed, same files)\n"
+         << "  --sailings N          sailings to create\n"
+         << "  --vehicles N          vehicles to register\n"
+         << "  --reservations N      bookings to attempt\n"
+         << "  --terminals N         departure terminals (more are added if needed)\n"
+         << "  --days N              days of the month used (1-31)\n"
+         << "  --terminal-skew X     how much busier the main terminals are\n"
+         << "  --special-ratio X     share of special vehicles (0-1)\n"
+         << "  --skew X              how strongly bookings favour popular sailings\n"
+         << "  --onboard X           share of bookings already checked in (0-1)\n"
+         << "  --shared-phones X     share of vehicles sharing a phone (0-1)\n";
+}
+
+// Reads a whole count from 'text' into 'value'; returns false if
+// it is not all digits or is larger than 'max'
+bool parseCount(const char* text, unsigned long long max, unsigned long long& value) {
+    if (!isdigit(static_cast<unsigned char>(text[0]))) {
+        return false;
+    }
+    char* end = NULL;
+    errno = 0;
+    value = strtoull(text, &end, 10);
+    return *end == '\0' && errno == 0 && value <= max;
+}
+
+// Reads a whole decimal number from 'text' into 'value'; returns
+// false if anything follows it
+bool parseDecimal(const char* text, double& value) {
+    char* end = NULL;
+    errno = 0;
+    value = strtod(text, &end);
+    return end != text && *end == '\0' && errno == 0;
+}
+
+// Reads the generator options into 'config'; returns false on a bad
+// option or a value that is not a number
+bool parseOptions(int argc, char* argv[], WorkloadConfig& config) {
+    // Loop goal: Read each option and its value
+    for (int i = 1; i < argc; i += 2) {
+        string option = argv[i];
+        if (i + 1 >= argc) {
+            cout << "✗ Missing value for " << option << "\n";
+            return false;
+        }
+        const char* value = argv[i + 1];
+        unsigned long long count = 0;
+        bool parsed = true;
+        if (option == "--seed") {
+            parsed = parseCount(value, UINT_MAX, count);
+            config.seed = static_cast<unsigned>(count);
+        }
+        else if (option == "--sailings") {
+            parsed = parseCount(value, SIZE_MAX, count);
+            config.sailings = static_cast<size_t>(count);
+        }
+        else if (option == "--vehicles") {
+            parsed = parseCount(value, SIZE_MAX, count);
+            config.vehicles = static_cast<size_t>(count);
+        }
+        else if (option == "--reservations") {
+            parsed = parseCount(value, SIZE_MAX, count);
+            config.reservations = static_cast<size_t>(count);
+        }
+        else if (option == "--terminals") {
+            parsed = parseCount(value, SIZE_MAX, count);
+            config.terminals = static_cast<size_t>(count);
+        }
+        else if (option == "--days") {
+            parsed = parseCount(value, INT_MAX, count);
+            config.days = static_cast<int>(count);
+        }
+        else if (option == "--terminal-skew") parsed = parseDecimal(value, config.terminalSkew);
+        else if (option == "--special-ratio") parsed = parseDecimal(value, config.specialRatio);
+        else if (option == "--skew") parsed = parseDecimal(value, config.bookingSkew);
+        else if (option == "--onboard") parsed = parseDecimal(value, config.onboardRatio);
+        else if (option == "--shared-phones") parsed = parseDecimal(value, config.sharedPhoneRatio);
+        else {
+            cout << "✗ Unknown option " << option << "\n";
+            return false;
+        }
+        if (!parsed) {
+            cout << "✗ Bad value " << value << " for " << option << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Generates a synthetic dataset from the command line options
+int generateData(int argc, char* argv[]) {
+    WorkloadConfig config;
+    if (!parseOptions(argc, argv, config)) {
+        printUsage();
+        return 1;
+    }
+    // Checked before anything is cleared, so bad options leave the
+    // existing data files alone
+    if (!workloadConfigValid(config)) {
+        cout << "✗ These options cannot be generated (check the ranges)\n";
+        printUsage();
+        return 1;
+    }
+
+    cout << "=== Ferry Reservation System - Synthetic Data Setup ===\n";
+    clearExistingData();
+
+    // The generator writes the data files itself, so the modules stay closed
+    chrono::steady_clock::time_point started = chrono::steady_clock::now();
+    WorkloadSummary summary;
+    bool generated = generateWorkload(config, summary);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+    if (!generated) {
+        cout << "✗ Could not generate the data (check the options)\n";
+        return 1;
+    }
+    cout << "Seed " << config.seed << ", generated in " << std::fixed
+         << std::setprecision(2) << seconds << " s:\n";
+    cout << "   • " << summary.sailings << " sailings from " << summary.terminals << " terminals\n";
+    cout << "   • " << summary.vehicles << " vehicles (" << summary.specialVehicles << " special)\n";
+    cout << "   • " << summary.reservations << " reservations (" << summary.onboard
+         << " checked in, " << summary.rejected << " dropped for lack of room)\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        if (string(argv[1]) == "--help") {
+            printUsage();
+            return 0;
+        }
+        return generateData(argc, argv);
+    }
+
     cout << "=== Ferry Reservation System - Demo Data Setup ===\n";
     cout << "Setting up demo data as requested by Russ...\n\n";
     
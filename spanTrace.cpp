@@ -0,0 +1,99 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the span trace declared in spanTrace.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial Chrome trace-event spans.
+//************************************************************
+
+#include "spanTrace.h"
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+std::atomic<bool> spanTraceOpen(false);
+
+//--------------------------------------------------
+// The open span file, whether a span has been written yet (for
+// the commas), and the time ts counts from. Guarded by spanLock.
+static std::mutex spanLock;
+static std::ofstream spanFile;
+static bool firstSpan = true;
+static std::chrono::steady_clock::time_point spanStarted;
+
+//--------------------------------------------------
+// Function: threadNumber
+//--------------------------------------------------
+// Returns a small number for the calling thread, 1 for the first
+// thread that writes a span, used as the event's tid.
+static int threadNumber()
+{
+    static std::atomic<int> nextThread(1);
+    static thread_local int number = nextThread.fetch_add(1);
+    return number;
+}
+
+//--------------------------------------------------
+// Function: microsFrom
+//--------------------------------------------------
+// Returns the time from 'from' to 'to' in microseconds, keeping
+// nanoseconds as three decimals.
+static double microsFrom(std::chrono::steady_clock::time_point from,
+                         std::chrono::steady_clock::time_point to)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count() / 1000.0;
+}
+
+bool startSpanTrace(const std::string &path)
+{
+    stopSpanTrace();
+    std::lock_guard<std::mutex> hold(spanLock);
+    spanFile.open(path, std::ios::out | std::ios::trunc);
+    if (!spanFile.is_open())
+        return false;
+    spanFile << "[\n";
+    spanFile.setf(std::ios::fixed);
+    spanFile.precision(3);
+    firstSpan = true;
+    spanStarted = std::chrono::steady_clock::now();
+    spanTraceOpen.store(true, std::memory_order_relaxed);
+    return true;
+}
+
+void stopSpanTrace()
+{
+    std::lock_guard<std::mutex> hold(spanLock);
+    spanTraceOpen.store(false, std::memory_order_relaxed);
+    if (spanFile.is_open())
+    {
+        spanFile << "\n]\n";
+        spanFile.close();
+    }
+}
+
+void writeSpan(const char *name, std::chrono::steady_clock::time_point started,
+               std::chrono::steady_clock::time_point finished, bool failed)
+{
+    int tid = threadNumber();
+    const char *scope = std::strstr(name, "::");
+    size_t categoryLength = scope != NULL ? static_cast<size_t>(scope - name) : std::strlen(name);
+
+    std::lock_guard<std::mutex> hold(spanLock);
+    if (!spanFile.is_open())
+        return;
+    if (!firstSpan)
+        spanFile << ",\n";
+    firstSpan = false;
+    spanFile << "{\"name\":\"" << name << "\",\"cat\":\"";
+    spanFile.write(name, static_cast<std::streamsize>(categoryLength));
+    spanFile << "\",\"ph\":\"X\",\"ts\":" << microsFrom(spanStarted, started)
+             << ",\"dur\":" << microsFrom(started, finished)
+             << ",\"pid\":1,\"tid\":" << tid;
+    if (failed)
+        spanFile << ",\"args\":{\"failed\":true}";
+    spanFile << '}';
+}
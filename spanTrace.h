@@ -0,0 +1,104 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the span trace: an optional Chrome trace-event JSON
+//   file with one span per store operation, core API call, full
+//   scan, rewrite and flush. Spans nest by time on each thread,
+//   so a trace viewer (chrome://tracing, Perfetto) shows what a
+//   slow booking did, e.g. addReservation > getSailingFromIO >
+//   sailingFileIO::getSailing.
+//************************************************************
+// USAGE:
+// - startSpanTrace() opens the file (ferry_system does this when
+//   FRSS_SPANS names a file, ferry_replay with --spans FILE);
+//   stopSpanTrace() closes the JSON array.
+// - Every LatencyTimer (latencyStats.h) writes its span, under
+//   its statistic name. Steps that are not API calls open a
+//   SpanScope:
+//       SpanScope span("recordIO::readAllRecords");
+// - With tracing off a span costs one relaxed atomic load.
+//
+// Each span is a complete ("ph":"X") event with ts and dur in
+// microseconds from startSpanTrace(), the category before "::"
+// in its name, and "failed":true in args if the call failed.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial Chrome trace-event spans.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef SPAN_TRACE_H
+#define SPAN_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+// true while a span trace is open; read through spanTracing()
+extern std::atomic<bool> spanTraceOpen;
+
+//--------------------------------------------------
+// Starts writing spans to 'path' (replacing the file).
+// Returns false if the file cannot be created.
+bool startSpanTrace(
+    const std::string &path // in: JSON file to write
+);
+
+//--------------------------------------------------
+// Ends the JSON array and closes the file, if one is open.
+void stopSpanTrace();
+
+//--------------------------------------------------
+// Returns true while spans are being written.
+inline bool spanTracing()
+{
+    return spanTraceOpen.load(std::memory_order_relaxed);
+}
+
+//--------------------------------------------------
+// Writes one span for the calling thread. Does nothing if the
+// trace has been stopped. Names are literals without quotes or
+// backslashes.
+void writeSpan(
+    const char *name,                                // in: span name
+    std::chrono::steady_clock::time_point started,   // in: when it began
+    std::chrono::steady_clock::time_point finished,  // in: when it ended
+    bool failed                                      // in: true if the call failed
+);
+
+//--------------------------------------------------
+// Writes a span for the enclosing scope, if tracing was on when
+// it opened.
+class SpanScope
+{
+public:
+    explicit SpanScope(
+        const char *name // in: span name (a literal)
+    )
+        : name(name), active(spanTracing())
+    {
+        if (active)
+            started = std::chrono::steady_clock::now();
+    }
+
+    ~SpanScope()
+    {
+        if (active)
+            writeSpan(name, started, std::chrono::steady_clock::now(), false);
+    }
+
+private:
+    const char *name;
+    bool active;
+    std::chrono::steady_clock::time_point started;
+
+    SpanScope(const SpanScope &);
+    SpanScope &operator=(const SpanScope &);
+};
+
+#endif // SPAN_TRACE_H
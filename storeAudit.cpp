@@ -0,0 +1,236 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the store audit declared in storeAudit.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial counter and capacity audit.
+//************************************************************
+
+#include "storeAudit.h"
+#include "latencyStats.h"
+#include "reservation.h"
+#include "reservationFileIO.h"
+#include "sailing.h"
+#include "sailingFileIO.h"
+#include "threadPool.h"
+#include "vehicle.h"
+#include "vehicleFileIO.h"
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+//--------------------------------------------------
+// Reservations are checked, and sailings recomputed, in chunks
+// of this many
+const size_t AUDIT_RESERVATION_CHUNK = 16384;
+const size_t AUDIT_SAILING_CHUNK = 256;
+
+// Largest difference, in meters or dollars, still taken as a
+// match: the stored values are float running sums
+const float AUDIT_TOLERANCE = 0.05f;
+
+// What a reservation turned out to be
+enum ReservationStatus
+{
+    RESERVATION_OK,
+    RESERVATION_BAD,    // empty plate or sailing ID
+    RESERVATION_ORPHAN  // sailing not on file
+};
+
+//--------------------------------------------------
+// Values a sailing should hold given its reservations.
+struct ExpectedSailing
+{
+    int reserved;
+    int onboard;
+    int special;
+    float revenue;
+    float lrl;
+    float hrl;
+};
+
+//--------------------------------------------------
+// Function: boundedString
+//--------------------------------------------------
+// Builds a string from a fixed-length, possibly unterminated field.
+static std::string boundedString(const char *field, size_t size)
+{
+    return std::string(field, strnlen(field, size));
+}
+
+//--------------------------------------------------
+// Function: differs
+//--------------------------------------------------
+// Returns true if two stored amounts are further apart than the
+// float sums that built them can explain.
+static bool differs(float stored, float expected)
+{
+    return std::fabs(stored - expected) > AUDIT_TOLERANCE;
+}
+
+//--------------------------------------------------
+// Function: withExpected
+//--------------------------------------------------
+// Returns a copy of 'sailing' holding the expected counters,
+// revenue and remaining lengths.
+static Sailing withExpected(const Sailing &sailing, const ExpectedSailing &e)
+{
+    Sailing fixed;
+    fixed.createSailing(std::string(sailing.getSailingID()) + "|" + sailing.getVesselID() + "|" +
+                        std::to_string(sailing.getLCLL()) + "|" + std::to_string(sailing.getHCLL()) + "|" +
+                        std::to_string(e.lrl) + "|" + std::to_string(e.hrl) + "|" +
+                        std::to_string(e.reserved) + "|" + std::to_string(e.onboard) + "|" +
+                        std::to_string(e.special) + "|" + std::to_string(e.revenue));
+    return fixed;
+}
+
+StoreAudit auditStores(bool repair)
+{
+    static LatencyStat &stat = latencyStat("storeAudit::auditStores");
+    LatencyTimer timer(stat);
+    StoreAudit audit;
+    audit.badReservations = 0;
+    audit.orphans = 0;
+    audit.repaired = 0;
+
+    const std::vector<SailingReportRow> &rows = sailingFileIO::reportRows();
+    std::unordered_map<std::string, size_t> slotOf;
+    // Loop goal: Index the sailings on file by ID
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        slotOf[rows[i].sailing.getSailingID()] = i;
+    }
+
+    std::vector<Vehicle> vehicles;
+    FileIOforVehicle vehicleIO;
+    if (vehicleIO.open())
+    {
+        vehicles = vehicleIO.getAllVehicles();
+        vehicleIO.close();
+    }
+    std::unordered_map<std::string, size_t> vehicleOf;
+    // Loop goal: Index the vehicles by license plate
+    for (size_t i = 0; i < vehicles.size(); ++i)
+    {
+        vehicleOf[vehicles[i].getLicense()] = i;
+    }
+
+    std::vector<ReservationRecord> reservations = getAllReservations();
+    size_t count = reservations.size();
+    audit.sailings = rows.size();
+    audit.reservations = count;
+
+    // One row per reservation: its status, sailing slot, footprint and fare
+    std::vector<char> status(count);
+    std::vector<size_t> sailingOf(count);
+    std::vector<char> special(count);
+    std::vector<float> length(count), height(count), fare(count);
+
+    // Check each chunk of reservations against the sailing and
+    // vehicle maps, which are only read here
+    parallelFor(count, AUDIT_RESERVATION_CHUNK, [&](size_t begin, size_t end)
+    {
+        // Loop goal: Validate and price each reservation in the chunk
+        for (size_t i = begin; i < end; ++i)
+        {
+            std::string plate = boundedString(reservations[i].licensePlate, LICENSE_PLATE_MAX);
+            std::string sailingID = boundedString(reservations[i].sailingID, SAILING_ID_MAX);
+            std::unordered_map<std::string, size_t>::const_iterator s = slotOf.find(sailingID);
+            if (plate.empty() || sailingID.empty())
+            {
+                status[i] = RESERVATION_BAD;
+                continue;
+            }
+            if (s == slotOf.end())
+            {
+                status[i] = RESERVATION_ORPHAN;
+                continue;
+            }
+            status[i] = RESERVATION_OK;
+            sailingOf[i] = s->second;
+
+            std::unordered_map<std::string, size_t>::const_iterator v = vehicleOf.find(plate);
+            const Vehicle *vehicle = v != vehicleOf.end() ? &vehicles[v->second] : NULL;
+            bool isSpecial = vehicle != NULL && vehicle->isSpecial();
+            special[i] = isSpecial ? 1 : 0;
+            length[i] = isSpecial ? vehicle->getLength() : REGULAR_LENGTH;
+            height[i] = isSpecial ? vehicle->getHeight() : REGULAR_HEIGHT;
+            fare[i] = vehicle != NULL ? calculateFare(isSpecial, vehicle->getLength(), vehicle->getHeight())
+                                      : calculateFare(false, 0.0f, 0.0f);
+        }
+    });
+
+    std::vector<std::vector<size_t> > booked(rows.size());
+    // Loop goal: Count the invalid reservations and group the rest
+    // by sailing, in file order
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (status[i] == RESERVATION_BAD)
+            ++audit.badReservations;
+        else if (status[i] == RESERVATION_ORPHAN)
+            ++audit.orphans;
+        else
+            booked[sailingOf[i]].push_back(i);
+    }
+
+    std::vector<ExpectedSailing> expected(rows.size());
+    std::vector<char> wrong(rows.size());
+    // Recompute each chunk of sailings from their own reservations
+    parallelFor(rows.size(), AUDIT_SAILING_CHUNK, [&](size_t begin, size_t end)
+    {
+        // Loop goal: Recompute and compare each sailing in the chunk
+        for (size_t s = begin; s < end; ++s)
+        {
+            const Sailing &sailing = rows[s].sailing;
+            ExpectedSailing &e = expected[s];
+            e.reserved = static_cast<int>(booked[s].size());
+            e.onboard = 0;
+            e.special = 0;
+            e.revenue = 0.0f;
+            // every vehicle but the first is loaded with spacing
+            float usedLength = e.reserved > 1 ? VEHICLE_SPACING * (e.reserved - 1) : 0.0f;
+            float usedHeight = 0.0f;
+            // Loop goal: Add up the counts, fares and footprint of each booking
+            for (size_t i : booked[s])
+            {
+                e.special += special[i];
+                usedLength += length[i];
+                usedHeight += height[i];
+                if (reservations[i].onboard)
+                {
+                    ++e.onboard;
+                    e.revenue += fare[i];
+                }
+            }
+            e.lrl = static_cast<float>(sailing.getLCLL()) - usedLength;
+            e.hrl = static_cast<float>(sailing.getHCLL()) - usedHeight;
+            wrong[s] = sailing.getReservedCount() != e.reserved || sailing.getOnboardCount() != e.onboard ||
+                       sailing.getSpecialCount() != e.special || differs(sailing.getRevenue(), e.revenue) ||
+                       differs(sailing.getLRL(), e.lrl) || differs(sailing.getHRL(), e.hrl);
+        }
+    });
+
+    std::vector<Sailing> fixes;
+    // Loop goal: List each mismatched sailing and build its repair
+    for (size_t s = 0; s < rows.size(); ++s)
+    {
+        if (!wrong[s])
+            continue;
+        audit.mismatched.push_back(rows[s].sailing.getSailingID());
+        if (repair)
+            fixes.push_back(withExpected(rows[s].sailing, expected[s]));
+    }
+    // Loop goal: Save each repaired sailing
+    for (const Sailing &fixed : fixes)
+    {
+        if (sailingFileIO::saveSailing(fixed))
+            ++audit.repaired;
+        else
+            timer.fail();
+    }
+    return audit;
+}
@@ -0,0 +1,57 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares the store audit: checks that imported or long-lived
+//   data files agree with each other. Every reservation must
+//   name a sailing on file, and every sailing's counters, revenue
+//   and remaining deck space must match the reservations booked
+//   on it. Optionally rewrites the sailings that do not.
+//************************************************************
+// USAGE:
+// - Open the sailing and reservation stores first, then call
+//   auditStores(). Reservations are validated and sailings
+//   recomputed in parallel on the shared thread pool; only the
+//   repairs write to the stores.
+// - Capacity and fares are recomputed from the registered
+//   vehicles, the way checkInBatch() prices them: unregistered
+//   vehicles count as regular.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial counter and capacity audit.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef STORE_AUDIT_H
+#define STORE_AUDIT_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+//--------------------------------------------------
+// Outcome of one audit.
+struct StoreAudit
+{
+    size_t sailings;         // sailings checked
+    size_t reservations;     // reservations checked
+    size_t badReservations;  // with an empty plate or sailing ID
+    size_t orphans;          // on a sailing that is not on file
+    size_t repaired;         // sailings rewritten with recomputed values
+    std::vector<std::string> mismatched; // sailings whose counters or space disagree, in file order
+};
+
+//--------------------------------------------------
+// Checks every reservation and recomputes every sailing's
+// reserved, onboard and special counts, revenue, LRL and HRL
+// from its reservations. With 'repair', sailings that disagree
+// are saved with the recomputed values.
+StoreAudit auditStores(
+    bool repair // in: rewrite mismatched sailings
+);
+
+#endif // STORE_AUDIT_H
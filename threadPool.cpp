@@ -0,0 +1,199 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the work-stealing thread pool and the chunked
+//   parallelFor() helper declared in threadPool.h.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial work-stealing pool and chunked helpers.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - parallelFor() waits on a condition variable instead
+//            of spinning once no chunk is left to help with.
+//************************************************************
+
+#include "threadPool.h"
+
+//--------------------------------------------------
+// Index of the pool worker running on this thread, or -1 for
+// threads that do not belong to a pool
+static thread_local int workerIndex = -1;
+
+ThreadPool::ThreadPool(unsigned threadCount)
+    : queued(0), nextQueue(0), stopping(false)
+{
+    if (threadCount == 0)
+        threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0)
+        threadCount = 1;
+
+    // Loop goal: Create one deque per worker before any thread starts
+    for (unsigned i = 0; i < threadCount; ++i)
+    {
+        queues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue()));
+    }
+    // Loop goal: Start each worker on its own deque
+    for (unsigned i = 0; i < threadCount; ++i)
+    {
+        workers.push_back(std::thread(&ThreadPool::workerLoop, this, i));
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    // Loop goal: Wait for every worker to exit
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(Task task)
+{
+    unsigned index;
+    if (workerIndex >= 0 && static_cast<unsigned>(workerIndex) < queues.size())
+        index = static_cast<unsigned>(workerIndex);
+    else
+        index = nextQueue++ % queues.size();
+
+    {
+        std::lock_guard<std::mutex> guard(queues[index]->lock);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // counted under sleepLock so a worker checking before it
+        // sleeps cannot miss the new task
+        std::lock_guard<std::mutex> guard(sleepLock);
+        ++queued;
+    }
+    wake.notify_one();
+}
+
+bool ThreadPool::runPendingTask()
+{
+    Task task;
+    int self = workerIndex;
+    bool found = (self >= 0 && popLocal(static_cast<unsigned>(self), task)) ||
+                 steal(self >= 0 ? static_cast<unsigned>(self) : queues.size(), task);
+    if (!found)
+        return false;
+    task();
+    return true;
+}
+
+unsigned ThreadPool::size() const
+{
+    return static_cast<unsigned>(workers.size());
+}
+
+ThreadPool &ThreadPool::instance()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+bool ThreadPool::popLocal(unsigned index, Task &task)
+{
+    WorkQueue &queue = *queues[index];
+    std::lock_guard<std::mutex> guard(queue.lock);
+    if (queue.tasks.empty())
+        return false;
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    --queued;
+    return true;
+}
+
+bool ThreadPool::steal(unsigned index, Task &task)
+{
+    size_t count = queues.size();
+    // Loop goal: Visit every other worker's deque once, starting after our own
+    for (size_t offset = 1; offset <= count; ++offset)
+    {
+        size_t victim = (index + offset) % count;
+        if (victim == index)
+            continue;
+        WorkQueue &queue = *queues[victim];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        if (!queue.tasks.empty())
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            --queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(unsigned index)
+{
+    workerIndex = static_cast<int>(index);
+    Task task;
+    // Loop goal: Run local work, then stolen work, then sleep until more arrives
+    while (true)
+    {
+        if (popLocal(index, task) || steal(index, task))
+        {
+            task();
+            task = Task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(sleepLock);
+        wake.wait(guard, [this] { return stopping || queued > 0; });
+        if (stopping)
+            return;
+    }
+}
+
+void parallelFor(size_t count, size_t chunkSize,
+                 const std::function<void(size_t, size_t)> &body)
+{
+    if (count == 0)
+        return;
+    if (chunkSize == 0)
+        chunkSize = 1;
+    if (count <= chunkSize)
+    {
+        body(0, count);
+        return;
+    }
+
+    ThreadPool &pool = ThreadPool::instance();
+    size_t chunks = (count + chunkSize - 1) / chunkSize;
+    size_t remaining = chunks;   // guarded by doneLock
+    std::mutex doneLock;
+    std::condition_variable allDone;
+
+    // Loop goal: Queue one task per chunk
+    for (size_t c = 0; c < chunks; ++c)
+    {
+        size_t begin = c * chunkSize;
+        size_t end = std::min(count, begin + chunkSize);
+        pool.submit([&body, &remaining, &doneLock, &allDone, begin, end]
+        {
+            body(begin, end);
+            // notified under the lock so the waiting caller cannot
+            // return and free the condition before it is signalled
+            std::lock_guard<std::mutex> guard(doneLock);
+            if (--remaining == 0)
+                allDone.notify_all();
+        });
+    }
+
+    // Loop goal: Help run queued chunks; once none are left to take,
+    // sleep until the chunks still running on workers finish
+    while (pool.runPendingTask())
+    {
+    }
+    std::unique_lock<std::mutex> guard(doneLock);
+    allDone.wait(guard, [&remaining] { return remaining == 0; });
+}
@@ -0,0 +1,160 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares a work-stealing thread pool used to spread bulk
+//   jobs (whole-file scans, rebuilds, reports) over all cores.
+//   Each worker owns a deque: it pops its own work from the
+//   back and steals from the front of other workers' deques
+//   when it runs dry.
+//************************************************************
+// USAGE:
+// - Use ThreadPool::instance() for the shared pool, sized to
+//   the number of hardware threads.
+// - Use parallelFor() or parallelFilter() for chunked loops;
+//   both block until every chunk has finished and the calling
+//   thread helps run chunks while it waits.
+// - Small inputs (one chunk or fewer) run inline on the caller.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial work-stealing pool and chunked helpers.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - parallelFor() sleeps instead of spinning while the
+//            last chunks finish; documented the callers' contract.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//--------------------------------------------------
+// Pool of worker threads with per-worker task deques.
+class ThreadPool
+{
+public:
+    typedef std::function<void()> Task;
+
+    // Starts 'threadCount' workers (0 = hardware concurrency).
+    explicit ThreadPool(unsigned threadCount = 0);
+
+    // Stops and joins all workers. Queued tasks are discarded.
+    ~ThreadPool();
+
+    // Queues a task. Tasks submitted from a worker go to that
+    // worker's own deque, others are spread round-robin.
+    void submit(Task task);
+
+    // Runs one queued task on the calling thread if any worker
+    // has one. Returns false if every deque was empty.
+    bool runPendingTask();
+
+    // Returns the number of worker threads.
+    unsigned size() const;
+
+    // Returns the process-wide shared pool.
+    static ThreadPool &instance();
+
+private:
+    // A worker's task deque and the lock guarding it
+    struct WorkQueue
+    {
+        std::deque<Task> tasks;
+        std::mutex lock;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> queued;       // tasks sitting in any deque
+    std::atomic<unsigned> nextQueue;  // round-robin cursor for outside submits
+    std::mutex sleepLock;
+    std::condition_variable wake;
+    bool stopping;
+
+    ThreadPool(const ThreadPool &);
+    ThreadPool &operator=(const ThreadPool &);
+
+    // pops from the back of queue 'index'
+    bool popLocal(unsigned index, Task &task);
+    // steals from the front of any queue other than 'index'
+    bool steal(unsigned index, Task &task);
+    // main loop run by each worker thread
+    void workerLoop(unsigned index);
+};
+
+//--------------------------------------------------
+// Calls body(begin, end) over [0, count) split into chunks of
+// 'chunkSize' items, spread across the shared pool. Returns
+// when every chunk has run. Chunks run on several threads at once:
+// body() may write only the items of its own range.
+void parallelFor(
+    size_t count,                                      // in: number of items
+    size_t chunkSize,                                  // in: items per chunk
+    const std::function<void(size_t, size_t)> &body    // in: chunk worker
+);
+
+//--------------------------------------------------
+// Returns the records for which keep(record) is true, in their
+// original order. Chunks of 'chunkSize' records are scanned in
+// parallel and their matches concatenated. keep() runs on several
+// threads at once and must not write shared state.
+template <typename Record, typename Predicate>
+std::vector<Record> parallelFilter(
+    const std::vector<Record> &records, // in: records to scan
+    Predicate keep,                     // in: match test
+    size_t chunkSize = 16384            // in: records per chunk
+)
+{
+    std::vector<Record> results;
+    if (records.size() <= chunkSize)
+    {
+        // Loop goal: Single chunk, scan inline without the pool
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            if (keep(records[i]))
+                results.push_back(records[i]);
+        }
+        return results;
+    }
+
+    size_t chunkCount = (records.size() + chunkSize - 1) / chunkSize;
+    std::vector<std::vector<Record>> parts(chunkCount);
+
+    parallelFor(chunkCount, 1, [&](size_t first, size_t last)
+    {
+        // Loop goal: Scan each chunk in this range into its own bucket
+        for (size_t c = first; c < last; ++c)
+        {
+            size_t begin = c * chunkSize;
+            size_t end = std::min(records.size(), begin + chunkSize);
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (keep(records[i]))
+                    parts[c].push_back(records[i]);
+            }
+        }
+    });
+
+    // Loop goal: Concatenate chunk buckets in file order
+    for (size_t c = 0; c < chunkCount; ++c)
+    {
+        results.insert(results.end(), parts[c].begin(), parts[c].end());
+    }
+    return results;
+}
+
+#endif // THREAD_POOL_H
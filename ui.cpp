@@ -16,26 +16,63 @@
 // Rev. 2 - 2025/08/05 - James Nguyen
 //          - Finalized interface and aligned with .cpp
 // implementation.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Lane check-in and group reservations; reservation
+//            summaries come from the sailing's counters.
+//          - Added the Query Sailings and Revenue Report menus.
+//          - Reservation lists come from one manifest join.
+//          - Added Find by Phone to Manage Reservations.
+//          - Added Search Plates to Manage Vehicles.
+//          - Operations are recorded in the operation trace when
+//            FRSS_TRACE names a trace file.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - The sailing and vehicle screens are in sailingMenu.cpp
+//            and vehicleMenu.cpp; the core they call is libfrss.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - Added the Statistics menu; latency statistics are
+//            appended to FRSS_STATS (latencyStats.txt) at shutdown.
+// Rev. 6 - 2026/10/18 - Group 19
+//          - FRSS_SPANS names a Chrome trace-event file of spans.
+// Rev. 7 - 2026/10/18 - Group 19
+//          - Statistics also shows the storage I/O of each
+//            top-level operation.
 //************************************************************
 
 
 #include "ui.h"
 #include "sailing.h"
 #include "sailingFileIO.h"
+#include "sailingMenu.h"
 #include "vehicle.h"
 #include "vehicleFileIO.h"
+#include "vehicleMenu.h"
 #include "reservation.h"
 #include "reservationFileIO.h"
+#include "revenueReport.h"
+#include "operationTrace.h"
+#include "latencyStats.h"
+#include "ioStats.h"
+#include "spanTrace.h"
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <iomanip>
 #include <limits>
 #include <cctype>
+#include <sstream>
+#include <unordered_map>
 
 using namespace std;
 
 namespace UI {
 
+    // Results shown per plate search, and the fuzzy search radius
+    const size_t PLATE_SEARCH_LIMIT = 20;
+    const int PLATE_SEARCH_DISTANCE = 2;
+
+    // File the latency statistics are appended to, unless FRSS_STATS names one
+    const char* const DEFAULT_STATS_FILE = "latencyStats.txt";
+
     // Validation helper functions
     bool isValidSailingID(const string &id)
     {
@@ -191,14 +228,13 @@ namespace UI {
     
     // Add new sailing with step-by-step process
     bool addNewSailing() {
-        // Call the existing Sailing::addSailing() function
-        return Sailing::addSailing();
+        return SailingMenu::addSailing();
     }
     
     // Edit sailing interface
     void editSailing(const char* sailingID) {
-        // Use the static Sailing::editSailing method which includes validation
-        Sailing::editSailing(sailingID);
+        // SailingMenu::editSailing checks that the sailing exists
+        SailingMenu::editSailing(sailingID);
     }
 
     // Display vehicle management submenu
@@ -250,7 +286,8 @@ namespace UI {
             cout << "\n";
             
             cout << "[0] Cancel\n";
-            cout << "[1] Add Vehicle\n\n";
+            cout << "[1] Add Vehicle\n";
+            cout << "[2] Search Plates\n\n";
             cout << "Format: License plate to edit (e.g., ABC123, BC1234, XYZ789)\n";
             cout << "Enter an option or license plate number: ";
             
@@ -269,6 +306,8 @@ namespace UI {
                     cout << "Vehicle addition failed or cancelled.\n";
                 }
                 pauseForUser();
+            } else if (input == "2") {
+                searchPlates();
             } else {
                 // Assume it's a license plate for editing
                 editVehicleDetailed(input);
@@ -282,6 +321,55 @@ namespace UI {
         return addVehicleFromUI();
     }
     
+    // Search plates by prefix, then by edit distance
+    void searchPlates() {
+        displayHeader("Search Plates");
+        cout << "[0] Cancel\n\n";
+        cout << "Format: Part or all of a license plate (e.g., BC, BC1234)\n";
+        string partial = getStringInput("Enter an option or plate: ");
+        if (partial == "CANCEL") {
+            return;
+        }
+        displayFooter();
+        
+        vector<string> starting;
+        vector<PlateMatch> similar;
+        {
+            TraceScope trace("searchPlates");
+            trace.arg(partial).arg(PLATE_SEARCH_LIMIT).arg(PLATE_SEARCH_DISTANCE);
+            FileIOforVehicle vehicleIO;
+            if (!vehicleIO.open()) {
+                cout << "Unable to access vehicle data.\n";
+                pauseForUser();
+                return;
+            }
+            starting = vehicleIO.findPlatesWithPrefix(partial, PLATE_SEARCH_LIMIT);
+            similar = vehicleIO.findSimilarPlates(partial, PLATE_SEARCH_DISTANCE, PLATE_SEARCH_LIMIT);
+            vehicleIO.close();
+        }
+        
+        displayHeader("Search Plates");
+        cout << "Plates starting with " << partial << ":\n";
+        if (starting.empty()) {
+            cout << "  None\n";
+        }
+        // Loop goal: Print each prefix match
+        for (const auto& plate : starting) {
+            cout << "  " << plate << "\n";
+        }
+        cout << "\nPlates within " << PLATE_SEARCH_DISTANCE << " typing errors:\n";
+        if (similar.empty()) {
+            cout << "  None\n";
+        }
+        // Loop goal: Print each fuzzy match with its distance
+        for (const auto& match : similar) {
+            cout << "  " << left << setw(15) << match.licensePlate
+                 << "  (" << match.distance << " off)\n";
+        }
+        displayFooter();
+        pauseForUser();
+    }
+    
     // Edit vehicle interface
     void editVehicleDetailed(const string& licensePlate) {
         // Call the existing editVehicleFromUI() function
@@ -302,7 +390,9 @@ namespace UI {
         {
             displayHeader("Manage Reservations");
             cout << "[0] Cancel\n";
-            cout << "[1] Check-In\n\n";
+            cout << "[1] Check-In\n";
+            cout << "[2] Lane Check-In\n";
+            cout << "[3] Find by Phone\n\n";
             cout << "Enter an option or sailing ID: ";
 
             string input;
@@ -316,6 +406,14 @@ namespace UI {
             {
                 checkInProcess();
             }
+            else if (input == "2")
+            {
+                laneCheckInProcess();
+            }
+            else if (input == "3")
+            {
+                findReservationsByPhone();
+            }
             else if (input.empty())
             {
                 // Handle empty input - just continue to show menu again
@@ -445,8 +543,13 @@ namespace UI {
             // Add to database
             try
             {
+                TraceScope trace("addVehicle");
+                trace.arg(license).arg(phone).arg(length).arg(height);
                 Vehicle newVehicle;
-                newVehicle.addVehicle(license.c_str(), phone.c_str(), length, height);
+                if (newVehicle.addVehicle(license.c_str(), phone.c_str(), length, height))
+                    cout << "Vehicle successfully added to database.\n";
+                else
+                    cout << "Error: Failed to save vehicle to database.\n";
             }
             catch (...)
             {
@@ -468,6 +571,8 @@ namespace UI {
         {
             try
             {
+                TraceScope trace("addReservation");
+                trace.arg(sailingID).arg(license).arg(phone).arg(isSpecial).arg(height).arg(length);
                 return addReservation(string(sailingID), license, phone, isSpecial, height, length);
             }
             catch (...)
@@ -478,6 +583,91 @@ namespace UI {
         return false;
     }
     
+    // Add group reservation process
+    bool addNewGroupReservation(const char *sailingID)
+    {
+        displayHeader("Group Reservation");
+        cout << "[0] Cancel\n\n";
+        cout << "Vehicles must already be registered in Manage Vehicles.\n";
+        cout << "Format: License plates separated by spaces (e.g., ABC123 XYZ789)\n";
+        string line = getStringInput("Enter an option or license plates: ");
+        displayFooter();
+        if (line == "CANCEL")
+            return false;
+
+        vector<string> plates;
+        istringstream group(line);
+        string plate;
+        // Loop goal: Split the entered line into individual plates
+        while (group >> plate)
+        {
+            plates.push_back(plate);
+        }
+        if (plates.empty())
+        {
+            cout << "No license plates entered.\n";
+            return false;
+        }
+
+        unordered_map<string, Vehicle> vehicles;
+        FileIOforVehicle vehicleIO;
+        if (vehicleIO.open())
+        {
+            vehicles = vehicleIO.getVehicles(plates);
+            vehicleIO.close();
+        }
+
+        vector<GroupVehicle> members;
+        float totalLength = 0.0f;
+        // Loop goal: Look up each plate's dimensions, stopping at the first unknown plate
+        for (const auto &p : plates)
+        {
+            unordered_map<string, Vehicle>::const_iterator v = vehicles.find(p);
+            if (v == vehicles.end())
+            {
+                cout << "Vehicle " << p << " is not registered. No reservations were made.\n";
+                return false;
+            }
+            GroupVehicle member;
+            member.licensePlate = p;
+            member.isSpecial = v->second.isSpecial();
+            member.height = v->second.getHeight();
+            member.length = v->second.getLength();
+            totalLength += member.isSpecial ? member.length : 7.0f;
+            members.push_back(member);
+        }
+
+        displayHeader("Group Reservation");
+        cout << "Sailing ID: " << sailingID << "\n";
+        cout << "Vehicles: " << members.size() << "\n";
+        cout << "Total Vehicle Length: " << fixed << setprecision(1) << totalLength << "m (plus spacing)\n\n";
+        cout << "[0] Cancel\n[1] Add Group Reservation\n\n";
+        cout << "Enter an option: ";
+
+        int choice = getValidIntInput(0, 1);
+        displayFooter();
+        if (choice != 1)
+            return false;
+
+        bool booked;
+        {
+            TraceScope trace("addGroupReservation");
+            trace.arg(sailingID);
+            // Loop goal: Add each member's plate, type and dimensions
+            for (const auto &member : members)
+            {
+                trace.arg(member.licensePlate).arg(member.isSpecial).arg(member.height).arg(member.length);
+            }
+            booked = ::addGroupReservation(string(sailingID), members);
+        }
+        if (!booked)
+        {
+            cout << "Group could not be booked: a vehicle is already reserved or the sailing lacks space.\n";
+            return false;
+        }
+        return true;
+    }
+    
     // Edit/Delete reservation
     void editReservation(const char *sailingID, const string &licensePlate)
     {
@@ -516,37 +706,15 @@ namespace UI {
         }
         else if (choice == 9)
         {
-            // Before deleting, determine if it's a special vehicle to restore capacity correctly
-            bool isSpecial = false;
-            try {
-                FileIOforVehicle vehicleIO;
-                if (vehicleIO.open() && vehicleIO.exists(licensePlate)) {
-                    Vehicle vehicle = vehicleIO.getVehicle(licensePlate);
-                    isSpecial = vehicle.isSpecial();
-                    vehicleIO.close();
-                }
-            } catch (...) {
-                isSpecial = false; // Default to regular vehicle
+            // Deletes the reservation and restores the sailing's space and counters
+            bool cancelled;
+            {
+                TraceScope trace("cancelReservation");
+                trace.arg(sailingID).arg(licensePlate);
+                cancelled = cancelReservation(sailingID, licensePlate);
             }
-            
-            if (deleteReservation(licensePlate, sailingID))
+            if (cancelled)
             {
-                // Restore sailing capacity after successful deletion
-                try {
-                    Sailing sailing = Sailing::getSailingFromIO(sailingID);
-                    if (isSpecial) {
-                        // Restore 1 unit of HRL for special vehicle  
-                        sailing.hrlUpdate(-1.0f); // Negative to add back capacity
-                    } else {
-                        // Restore 1 unit of LRL for regular vehicle
-                        sailing.lrlUpdate(-1.0f); // Negative to add back capacity
-                    }
-                    // Save the updated sailing capacity to file
-                    sailingFileIO::saveSailing(sailing);
-                } catch (...) {
-                    // Capacity restoration failed, but deletion succeeded
-                }
-                
                 cout << "Reservation Successfully Deleted.\nReturning to the previous menu.\n";
             }
             else
@@ -572,15 +740,11 @@ namespace UI {
         return;
     displayFooter();
 
-    vector<ReservationRecord> records = getAllOnSailing(sailingID);
-
-    // Check if any non-checked-in reservations exist
+    // The sailing's counters tell us whether anyone is left to check in
     bool hasValid = false;
-    for (const auto &r : records) {
-        if (!r.onboard) {
-            hasValid = true;
-            break;
-        }
+    if (sailingFileIO::exists(sailingID.c_str())) {
+        Sailing sailing = Sailing::getSailingFromIO(sailingID.c_str());
+        hasValid = sailing.getReservedCount() > sailing.getOnboardCount();
     }
 
     if (!hasValid) {
@@ -589,36 +753,30 @@ namespace UI {
         return;
     }
 
-    displayHeader("Manage Reservation");
+    // One join gives every reservation's phone, type and dimensions
+    vector<ManifestRow> manifest;
+    {
+        TraceScope trace("getManifest");
+        trace.arg(sailingID);
+        FileIOforVehicle vehicleIO;
+        vehicleIO.open();
+        manifest = vehicleIO.getManifest(sailingID);
+        vehicleIO.close();
+    }
 
-    FileIOforVehicle vehicleIO;
-    vehicleIO.open();
+    displayHeader("Manage Reservation");
 
-    for (const auto &r : records)
+    // Loop goal: List each vehicle still waiting to check in
+    for (const auto &row : manifest)
     {
-        if (!r.onboard)
+        if (!row.onboard)
         {
-            string phone = "Unknown";
-            string type = "Rg Vehicle";
-
-            try
-            {
-                if (vehicleIO.exists(r.licensePlate))
-                {
-                    Vehicle v = vehicleIO.getVehicle(r.licensePlate);
-                    phone = v.getPhone();
-                    if (v.isSpecial())
-                        type = "Sp Vehicle";
-                }
-            }
-            catch (...) {}
-
-            cout << r.licensePlate << " - " << phone << " - " << type << "\n";
+            string phone = row.registered ? row.phone : "Unknown";
+            string type = row.isSpecial ? "Sp Vehicle" : "Rg Vehicle";
+            cout << row.licensePlate << " - " << phone << " - " << type << "\n";
         }
     }
 
-    vehicleIO.close();
-
     cout << "\n[0] Cancel\n\n";
     string license = getStringInput("Enter an option or license plate: ");
     if (license == "CANCEL")
@@ -626,15 +784,15 @@ namespace UI {
     displayFooter();
 
     // Ensure license is part of an existing non-onboard reservation
-    bool matchFound = false;
-    for (const auto &r : records) {
-        if (r.licensePlate == license && !r.onboard) {
-            matchFound = true;
+    const ManifestRow *match = NULL;
+    for (const auto &row : manifest) {
+        if (row.licensePlate == license && !row.onboard) {
+            match = &row;
             break;
         }
     }
 
-    if (!matchFound) {
+    if (match == NULL) {
         cout << "License plate not found or already checked-in. \nReturning to the previous menu.\n";
         pauseForUser();
         return;
@@ -644,28 +802,10 @@ namespace UI {
     cout << "Sailing ID: " << sailingID << "\n";
     cout << "License Plate: " << license << "\n";
 
-    bool isSpecial = false;
-    float height = 0.0f, length = 0.0f;
-
-    try
-    {
-        if (vehicleIO.open() && vehicleIO.exists(license))
-        {
-            Vehicle v = vehicleIO.getVehicle(license);
-            isSpecial = v.isSpecial();
-            height = v.getHeight();
-            length = v.getLength();
-            cout << (isSpecial ? "Special Vehicle" : "Regular Vehicle") << "\n\n";
-            vehicleIO.close();
-        }
-        else {
-            cout << "Regular Vehicle\n\n"; // fallback
-        }
-    }
-    catch (...)
-    {
-        cout << "Regular Vehicle\n\n"; // fallback
-    }
+    // unregistered vehicles fall back to regular
+    bool isSpecial = match->isSpecial;
+    float height = match->height, length = match->length;
+    cout << (isSpecial ? "Special Vehicle" : "Regular Vehicle") << "\n\n";
 
     cout << "[0] Cancel\n[1] Confirm Check-in\n\n";
     cout << "Enter a line number: ";
@@ -677,7 +817,12 @@ namespace UI {
     {
     case 1:
     {
-        float fare = checkIn(sailingID, license, isSpecial, height, length);
+        float fare;
+        {
+            TraceScope trace("checkIn");
+            trace.arg(sailingID).arg(license).arg(isSpecial).arg(height).arg(length);
+            fare = checkIn(sailingID, license, isSpecial, height, length);
+        }
 
         if (fare < 0)
             cout << "Reservation not found. Check-in failed.\n";
@@ -692,14 +837,229 @@ namespace UI {
     displayFooter();
 }
 
+// Lane check-in process
+void laneCheckInProcess()
+{
+    displayHeader("Lane Check-In");
+    cout << "[0] Cancel\n\n";
+    cout << "Format: Sailing ID (e.g., ABC-01-09, DEF-02-10)\n";
+    string sailingID = getStringInput("Enter an option or sailing ID: ");
+    if (sailingID == "CANCEL")
+        return;
+    if (!isValidSailingID(sailingID))
+    {
+        cout << "Invalid Sailing ID format. Must be AAA-NN-NN (e.g., ABC-01-23).\n";
+        pauseForUser();
+        return;
+    }
+
+    cout << "\nFormat: License plates separated by spaces (e.g., ABC123 XYZ789)\n";
+    string line = getStringInput("Enter an option or license plates: ");
+    if (line == "CANCEL")
+        return;
+    displayFooter();
+
+    vector<string> plates;
+    istringstream lane(line);
+    string plate;
+    // Loop goal: Split the entered line into individual plates
+    while (lane >> plate)
+    {
+        plates.push_back(plate);
+    }
+
+    if (plates.empty())
+    {
+        cout << "No license plates entered. Returning to the previous menu.\n";
+        pauseForUser();
+        return;
+    }
+
+    vector<CheckInResult> results;
+    {
+        TraceScope trace("checkInBatch");
+        trace.arg(sailingID);
+        // Loop goal: Add each plate in lane order
+        for (const auto &p : plates)
+        {
+            trace.arg(p);
+        }
+        results = checkInBatch(sailingID, plates);
+    }
+
+    displayHeader("Lane Check-In");
+    int checkedIn = 0;
+    float total = 0.0f;
+    // Loop goal: Report the outcome for each plate in lane order
+    for (const auto &result : results)
+    {
+        cout << "  " << left << setw(15) << result.licensePlate << "  ";
+        if (result.error.empty())
+        {
+            cout << "Checked-in  $" << fixed << setprecision(2) << result.fare << "\n";
+            ++checkedIn;
+            total += result.fare;
+        }
+        else
+        {
+            cout << result.error << "\n";
+        }
+    }
+    cout << "\n" << checkedIn << " of " << results.size()
+         << " vehicles checked-in. Total fares: $" << fixed << setprecision(2) << total << "\n";
+    displayFooter();
+    pauseForUser();
+}
+
+// Find a customer's upcoming reservations by phone number
+void findReservationsByPhone()
+{
+    displayHeader("Find by Phone");
+    cout << "[0] Cancel\n\n";
+    cout << "Format: Phone number (e.g., 604-555-1234)\n";
+    string phone = getStringInput("Enter an option or phone number: ");
+    if (phone == "CANCEL")
+        return;
+    displayFooter();
+
+    vector<string> plates;
+    vector<ReservationRecord> upcoming;
+    {
+        TraceScope trace("findByPhone");
+        trace.arg(phone);
+        FileIOforVehicle vehicleIO;
+        if (!vehicleIO.open())
+        {
+            cout << "Unable to access vehicle data.\n";
+            pauseForUser();
+            return;
+        }
+        plates = vehicleIO.getPlatesForPhone(phone);
+        upcoming = vehicleIO.getUpcomingForPhone(phone);
+        vehicleIO.close();
+    }
+
+    displayHeader("Find by Phone");
+    if (plates.empty())
+    {
+        cout << "No vehicles registered to " << phone << ".\n";
+    }
+    else
+    {
+        cout << "Vehicles registered to " << phone << ":";
+        // Loop goal: List each plate on one line
+        for (const auto &plate : plates)
+        {
+            cout << " " << plate;
+        }
+        cout << "\n\n";
+        if (upcoming.empty())
+        {
+            cout << "  No upcoming reservations.\n";
+        }
+        else
+        {
+            cout << "  License Plate    Sailing ID\n";
+            cout << "  ---------------  ----------\n";
+            // Loop goal: Print one line per upcoming reservation
+            for (const auto &reservation : upcoming)
+            {
+                cout << "  " << left << setw(15) << reservation.licensePlate
+                     << "  " << reservation.sailingID << "\n";
+            }
+        }
+    }
+    displayFooter();
+    pauseForUser();
+}
+
 // Display sailing report
 void showSailingReport() {
-    // Call the existing sailing report function (it handles its own header)
-    Sailing::displayReport();
+    // The sailing report screen handles its own header
+    SailingMenu::displayReport();
     
     pauseForUser();
 }
 
+// Display filtered and ranked sailings
+void showSailingQuery() {
+    SailingMenu::displayQueryReport();
+    
+    pauseForUser();
+}
+
+// Formats whole cents as dollars, e.g. 123456 -> "$1234.56"
+static string formatCents(long long cents) {
+    ostringstream out;
+    if (cents < 0) {
+        out << "-";
+        cents = -cents;
+    }
+    out << "$" << cents / 100 << "." << setw(2) << setfill('0') << cents % 100;
+    return out.str();
+}
+
+// Display revenue per sailing and per day
+void showRevenueReport() {
+    RevenueReport report;
+    {
+        TraceScope trace("revenueReport");
+        report = buildRevenueReport();
+    }
+
+    displayHeader("Revenue Report");
+    cout << "SAILING ID  VEHICLES        BOOKED     COLLECTED\n";
+    // Loop goal: Print one line per sailing
+    for (const auto& entry : report.sailings) {
+        cout << left << setw(10) << entry.sailingID << "  "
+             << right << setw(8) << entry.vehicles << "  "
+             << setw(12) << formatCents(entry.bookedCents) << "  "
+             << setw(12) << formatCents(entry.collectedCents) << "\n";
+    }
+
+    cout << "\nDAY  VEHICLES        BOOKED\n";
+    // Loop goal: Print one line per day of the month
+    for (const auto& day : report.days) {
+        cout << left << setw(3) << day.day << "  "
+             << right << setw(8) << day.vehicles << "  "
+             << setw(12) << formatCents(day.bookedCents) << "\n";
+    }
+
+    cout << "\nTotal booked: " << formatCents(report.totalCents)
+         << " (" << (fareKernelUsesAVX2() ? "AVX2" : "scalar") << " fare kernel)\n";
+    displayFooter();
+    pauseForUser();
+}
+
+// Returns the file the latency statistics are appended to
+static string statsPath() {
+    const char* path = getenv("FRSS_STATS");
+    return path != NULL && *path != '\0' ? path : DEFAULT_STATS_FILE;
+}
+
+// Display per-operation latency and storage I/O since the last reset
+void showStatistics() {
+    displayHeader("Statistics");
+    writeLatencyStats(cout);
+    cout << "\n";
+    writeIOStats(cout);
+    cout << "\n[0] Cancel\n[1] Reset Statistics (start a new shift)\n\n";
+    cout << "Enter an option: ";
+
+    int choice = getValidIntInput(0, 1);
+    displayFooter();
+    if (choice == 1) {
+        // The finished shift is kept in the statistics file
+        if (!dumpLatencyStats(statsPath())) {
+            cerr << "Unable to write statistics file " << statsPath() << ".\n";
+        }
+        resetLatencyStats();
+        resetIOStats();
+        cout << "Statistics reset.\n";
+        pauseForUser();
+    }
+}
+
     // Public interface implementation
     
     // Manage reservations for a specific sailing
@@ -709,37 +1069,42 @@ void showSailingReport() {
             
             // Display existing reservations for this sailing from actual data
             try {
-                vector<ReservationRecord> reservations = getAllOnSailing(sailingID);
+                // One join gives every reservation's phone and type; rows keep
+                // "N/A" details if the vehicle file can't be opened
+                vector<ManifestRow> manifest;
+                {
+                    TraceScope trace("getManifest");
+                    trace.arg(sailingID);
+                    FileIOforVehicle vehicleIO;
+                    vehicleIO.open();
+                    manifest = vehicleIO.getManifest(sailingID);
+                    vehicleIO.close();
+                }
                 cout << "Reservations for Sailing " << sailingID << ":\n";
+                if (sailingFileIO::exists(sailingID)) {
+                    Sailing sailing = Sailing::getSailingFromIO(sailingID);
+                    cout << "  Reserved: " << sailing.getReservedCount()
+                         << " (" << sailing.getSpecialCount() << " special, "
+                         << sailing.getRegularCount() << " regular)"
+                         << "  On Board: " << sailing.getOnboardCount()
+                         << "  Revenue: $" << fixed << setprecision(2)
+                         << sailing.getRevenue() << "\n";
+                }
                 
-                if (reservations.empty()) {
+                if (manifest.empty()) {
                     cout << "  No reservations found for this sailing.\n\n";
                 } else {
                     cout << "  License Plate    Phone Number     Type        Status\n";
                     cout << "  ---------------  ---------------  ----------  ----------\n";
                     
-                    FileIOforVehicle vehicleIO;
-                    bool vehicleIOOpen = vehicleIO.open();
-                    
-                    for (const auto& res : reservations) {
-                        string phoneNumber = "N/A";
-                        string vehicleType = "Unknown";
-                        
-                        // Get vehicle details for phone number and type
-                        if (vehicleIOOpen && vehicleIO.exists(res.licensePlate)) {
-                            Vehicle vehicle = vehicleIO.getVehicle(res.licensePlate);
-                            phoneNumber = vehicle.getPhone();
-                            vehicleType = vehicle.isSpecial() ? "Special" : "Regular";
-                        }
-                        
-                        cout << "  " << left << setw(15) << res.licensePlate 
-                             << "  " << setw(15) << phoneNumber
+                    // Loop goal: Print one manifest line per reservation
+                    for (const auto& row : manifest) {
+                        string vehicleType = !row.registered ? "Unknown"
+                                           : row.isSpecial ? "Special" : "Regular";
+                        cout << "  " << left << setw(15) << row.licensePlate 
+                             << "  " << setw(15) << row.phone
                              << "  " << setw(10) << vehicleType
-                             << "  " << (res.onboard ? "On Board" : "Reserved") << "\n";
-                    }
-                    
-                    if (vehicleIOOpen) {
-                        vehicleIO.close();
+                             << "  " << (row.onboard ? "On Board" : "Reserved") << "\n";
                     }
                     cout << "\n";
                 }
@@ -748,7 +1113,8 @@ void showSailingReport() {
             }
             
             cout << "[0] Cancel\n";
-            cout << "[1] New Reservation\n\n";
+            cout << "[1] New Reservation\n";
+            cout << "[2] Group Reservation\n\n";
             cout << "Enter an option or license plate: ";
             
             string input;
@@ -766,6 +1132,12 @@ void showSailingReport() {
                     cout << "Reservation Successfully Added. Returning to the main menu.\n";
                     pauseForUser();
                 }
+            } else if (input == "2") {
+                displayFooter();
+                if (addNewGroupReservation(sailingID)) {
+                    cout << "Group Reservation Successfully Added. Returning to the main menu.\n";
+                }
+                pauseForUser();
             } else if (input.empty()) {
                 displayFooter();
                 // Handle empty input - just continue to show menu again
@@ -799,12 +1171,33 @@ void showSailingReport() {
         cout << "Initializing Ferry Reservation System...\n";
         
         try {
+            // FRSS_SPANS=<file> writes a span for every store and core call,
+            // opened first so the initial loads are in it
+            const char* spansPath = getenv("FRSS_SPANS");
+            if (spansPath != NULL && *spansPath != '\0') {
+                if (startSpanTrace(spansPath)) {
+                    cout << "Writing spans to " << spansPath << ".\n";
+                } else {
+                    cerr << "Unable to write span file " << spansPath << ".\n";
+                }
+            }
+            
             // Initialize sailing module
             Sailing::initialize();
             
             // Initialize reservation module
             ::initialize(); // Call global initialize function from reservation.h
             
+            // FRSS_TRACE=<file> records every operation for ferry_replay
+            const char* tracePath = getenv("FRSS_TRACE");
+            if (tracePath != NULL && *tracePath != '\0') {
+                if (startTrace(tracePath)) {
+                    cout << "Recording operations to " << tracePath << ".\n";
+                } else {
+                    cerr << "Unable to write trace file " << tracePath << ".\n";
+                }
+            }
+            
             cout << "System initialized successfully.\n";
             return true;
         } catch (const exception& e) {
@@ -826,10 +1219,13 @@ void showSailingReport() {
             cout << "[2] Manage Vehicles\n";
             cout << "[3] Manage Reservations\n";
             cout << "[4] Show Sailing Report\n";
+            cout << "[5] Query Sailings\n";
+            cout << "[6] Revenue Report\n";
+            cout << "[7] Statistics\n";
             cout << "[0] Exit System\n\n";
             cout << "Enter a menu: ";
             
-            int choice = getValidIntInput(0, 4);
+            int choice = getValidIntInput(0, 7);
             displayFooter();
             
             switch (choice) {
@@ -845,6 +1241,15 @@ void showSailingReport() {
                 case 4:
                     showSailingReport();
                     break;
+                case 5:
+                    showSailingQuery();
+                    break;
+                case 6:
+                    showRevenueReport();
+                    break;
+                case 7:
+                    showStatistics();
+                    break;
                 case 0:
                     cout << "Thank you for using the Ferry Reservation System.\n";
                     cout << "Goodbye!\n";
@@ -863,6 +1268,14 @@ void showSailingReport() {
             // Shutdown reservation module
             ::shutdown(); // Call global shutdown function from reservation.h
             
+            stopTrace();
+            stopSpanTrace();
+            
+            // One section per run (or per shift, after a reset)
+            if (!dumpLatencyStats(statsPath())) {
+                cerr << "Unable to write statistics file " << statsPath() << ".\n";
+            }
+            
             cout << "System shutdown complete.\n";
         } catch (const exception& e) {
             cerr << "Error during shutdown: " << e.what() << "\n";
@@ -26,6 +26,11 @@
 // Rev. 3 - 2025/08/05 - James Nguyen
 //          - Finalized interface and aligned with .cpp 
 // implementation.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - Declared the input validators for the batch command
+//            mode.
+// Rev. 5 - 2026/10/18 - Group 19
+//          - Declared showStatistics().
 //************************************************************
 // in: Represents input parameter
 // out: Represents output parameter
@@ -63,13 +68,14 @@ namespace UI {
 
     // shutdown
     // Saves any pending changes and cleans up resources.
-    // Calls shutdown methods for sailing and reservation modules.
+    // Calls shutdown methods for sailing and reservation modules and
+    // appends the latency statistics to FRSS_STATS (latencyStats.txt).
     // out: none
     void shutdown();
 
     // manageReservationsForSailing
     // Manages reservations for a specific sailing ID.
-    // Called from sailing module when editing sailings.
+    // Called from the sailing menu when editing sailings.
     // in: sailingID - the sailing ID to manage reservations for
     // out: none
     void manageReservationsForSailing(const char* sailingID);
@@ -104,6 +110,12 @@ namespace UI {
     // out: bool - true if reservation was successfully added, false if cancelled
     bool addNewReservation(const char* sailingID);
     
+    // addNewGroupReservation
+    // Books a group of registered vehicles on the specified sailing at once
+    // in: sailingID - the sailing ID to add the reservations for
+    // out: bool - true if the whole group was booked, false if cancelled or rejected
+    bool addNewGroupReservation(const char* sailingID);
+    
     // editReservation
     // Edits or deletes a reservation for the specified sailing and license plate
     // in: sailingID - the sailing ID
@@ -116,11 +128,45 @@ namespace UI {
     // out: none
     void checkInProcess();
     
+    // laneCheckInProcess
+    // Checks in a whole lane of vehicles for one sailing at once
+    // out: none
+    void laneCheckInProcess();
+    
+    // searchPlates
+    // Lists plates starting with, or a few typing errors away
+    // from, what the user enters
+    // out: none
+    void searchPlates();
+    
+    // findReservationsByPhone
+    // Lists the upcoming reservations of every vehicle registered
+    // to a phone number
+    // out: none
+    void findReservationsByPhone();
+    
     // showSailingReport
     // Displays a comprehensive sailing report
     // out: none
     void showSailingReport();
     
+    // showSailingQuery
+    // Displays sailings matching user-chosen filters, ranked and limited
+    // out: none
+    void showSailingQuery();
+    
+    // showRevenueReport
+    // Displays booked and collected revenue per sailing and per day
+    // out: none
+    void showRevenueReport();
+    
+    // showStatistics
+    // Displays call counts, error counts, latency percentiles and
+    // storage I/O per operation, and lets the user reset them for a
+    // new shift
+    // out: none
+    void showStatistics();
+    
     // manageSailingsMenu
     // Displays and handles the sailing management submenu
     // out: none
@@ -165,6 +211,24 @@ namespace UI {
     // Pauses execution and waits for user to press Enter
     // out: none
     void pauseForUser();
+    
+    // isValidSailingID
+    // Checks the AAA-NN-NN sailing ID format
+    // in: id - the sailing ID to check
+    // out: bool - true if well formed
+    bool isValidSailingID(const string &id);
+    
+    // isValidLicensePlate
+    // Checks that a plate is 1-10 letters or digits
+    // in: plate - the license plate to check
+    // out: bool - true if well formed
+    bool isValidLicensePlate(const string &plate);
+    
+    // isValidPhoneNumber
+    // Checks that a phone number is exactly 10 digits
+    // in: phone - the phone number to check
+    // out: bool - true if well formed
+    bool isValidPhoneNumber(const string &phone);
 
 } // namespace UI
 
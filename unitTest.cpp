@@ -16,17 +16,81 @@
 //   We assume it works correctly as permitted by the assignment.
 //************************************************************
 // USAGE:
-// - Run this file independently. It will create and test a temp file.
-// - Console will print pass/fail results for each case.
+// - Run this file independently. It works in unit_test_data/,
+//   so the real data files are never touched.
+// - Console will print pass/fail results for each case; exits
+//   with status 1 if any case failed.
 //************************************************************
 // REVISION HISTORY:
 // Rev. 1 - 2025/07/24 - Danny Choi
 //          - Unit test focused on saveReservation() using test file.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Added batch save case for saveReservations().
+//          - Added bulk delete case for deleteReservationsWhere().
+//          - Added latency statistics case: calls and failed calls
+//            are counted per operation.
+//          - Added storage I/O case: an in-place save seeks, writes
+//            and flushes once and never scans the file.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Runs in unit_test_data/ and exits with status 1 on
+//            any failure.
+//          - rec3 uses a sailing ID that fits SAILING_ID_MAX.
+//          - Added checkInBatch() case against real stores.
+//          - Added reschedule and cancel cases for the sailing
+//            counters.
+//          - Added fare kernel case: both kernels agree with
+//            calculateFare() to the cent.
+//          - Added phone index cases: upkeep on save, phone change,
+//            rename and delete, revalidation on open, and log
+//            compaction.
+//          - Added plate trie cases: prefix and fuzzy searches,
+//            deletes and file replacement.
+//          - Added exists() case for a vehicle file replaced by one
+//            of the same size.
+//          - Added saveReservation() case: a failed overwrite in
+//            place counts as an error.
+//          - Added phone index case for a vehicle file replaced by
+//            one of the same size.
+//          - Added applyEdit() case: lanes shorter than the space
+//            taken are refused.
+//          - Added moveAllOnSailing() case: a failed write changes
+//            nothing.
+//          - Added deleteAllOnSailing() case: counters, space and
+//            revenue are cleared.
+//          - Added checkIn() case: the fare comes from the registered
+//            vehicle, not the dimensions passed in.
+//          - Added sailing store case: a file of the old record
+//            layout is refused on open.
+//          - Added applyEdit() case: a failed write keeping the ID
+//            leaves the sailing as it was.
 //************************************************************
 
 #include "reservationFileIO.h"
+#include "reservation.h"
+#include "sailing.h"
+#include "sailingFileIO.h"
+#include "vehicle.h"
+#include "vehicleFileIO.h"
+#include "latencyStats.h"
+#include "ioStats.h"
+#include "storeAudit.h"
+#include "revenueReport.h"
+#include <cstdio>
 #include <iostream>
 #include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//--------------------------------------------------
+// Scratch directory the tests run in
+const char *UNIT_TEST_DIR = "unit_test_data";
+
+// Number of failed cases
+static int failures = 0;
 
 //--------------------------------------------------
 // Utility function to compare two ReservationRecord objects
@@ -37,11 +101,141 @@ bool recordsEqual(const ReservationRecord &a, const ReservationRecord &b)
            a.onboard == b.onboard;
 }
 
+//--------------------------------------------------
+// Prints the outcome of one case and counts failures
+void report(int number, const char *name, bool passed)
+{
+    std::cout << "Test " << number << ": " << name << " - " << (passed ? "PASS" : "FAIL") << "\n";
+    if (!passed)
+        ++failures;
+}
+
+//--------------------------------------------------
+// Opens empty sailing, vehicle and reservation stores in the
+// scratch directory, closing whichever stores are open first
+void openEmptyStores()
+{
+    close();
+    Sailing::shutdown();
+    std::remove("sailingData.dat");
+    std::remove("vehicles.dat");
+    std::remove("phoneIndex.dat");
+    std::remove("reservation.dat");
+    Sailing::initialize();
+    initialize();
+}
+
+//--------------------------------------------------
+// Returns the plates the phone index lists for a phone
+std::vector<std::string> platesForPhone(const std::string &phone)
+{
+    std::vector<std::string> plates;
+    FileIOforVehicle vehicleIO;
+    if (vehicleIO.open())
+    {
+        plates = vehicleIO.getPlatesForPhone(phone);
+        vehicleIO.close();
+    }
+    return plates;
+}
+
+//--------------------------------------------------
+// Returns the plates starting with a prefix, as the store lists them
+std::vector<std::string> platesWithPrefix(const std::string &prefix, size_t limit)
+{
+    std::vector<std::string> plates;
+    FileIOforVehicle vehicleIO;
+    if (vehicleIO.open())
+    {
+        plates = vehicleIO.findPlatesWithPrefix(prefix, limit);
+        vehicleIO.close();
+    }
+    return plates;
+}
+
+//--------------------------------------------------
+// Returns the plates near a plate as "PLATE/distance" words, closest first
+std::string similarPlates(const std::string &plate, int maxDistance)
+{
+    std::string listed;
+    FileIOforVehicle vehicleIO;
+    if (vehicleIO.open())
+    {
+        std::vector<PlateMatch> matches = vehicleIO.findSimilarPlates(plate, maxDistance, 0);
+        // Loop goal: Append each match
+        for (size_t i = 0; i < matches.size(); ++i)
+        {
+            listed += (i == 0 ? "" : " ") + matches[i].licensePlate + "/" + std::to_string(matches[i].distance);
+        }
+        vehicleIO.close();
+    }
+    return listed;
+}
+
+//--------------------------------------------------
+// Returns the descriptor this process has open on a file in the
+// working directory, or -1 if there is none
+int descriptorOf(const std::string &name)
+{
+    const int MAX_DESCRIPTORS = 1024;
+    const std::string suffix = "/" + name;
+    // Loop goal: Check what each descriptor points at
+    for (int fd = 0; fd < MAX_DESCRIPTORS; ++fd)
+    {
+        char link[4096];
+        ssize_t length = readlink(("/proc/self/fd/" + std::to_string(fd)).c_str(), link, sizeof(link) - 1);
+        if (length <= 0)
+            continue;
+        std::string target(link, static_cast<size_t>(length));
+        if (target.size() >= suffix.size() &&
+            target.compare(target.size() - suffix.size(), suffix.size(), suffix) == 0)
+            return fd;
+    }
+    return -1;
+}
+
+//--------------------------------------------------
+// Replaces vehicles.dat with a copy in which 'from' is changed to
+// 'to' (same length), the way an import or restore would: a new
+// file of the same size renamed over the old one. Returns false
+// if 'from' is not in the file or the copy cannot be written.
+bool replaceInVehicleFile(const std::string &from, const std::string &to)
+{
+    std::string bytes;
+    {
+        std::ifstream in("vehicles.dat", std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    size_t at = bytes.find(from);
+    if (at == std::string::npos || from.size() != to.size())
+        return false;
+    bytes.replace(at, from.size(), to);
+    std::ofstream out("vehicles.tmp", std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    out.close();
+    return out.good() && std::rename("vehicles.tmp", "vehicles.dat") == 0;
+}
+
+//--------------------------------------------------
+// Returns the size of a file in bytes, or -1 if it is missing
+long fileBytes(const char *name)
+{
+    struct stat info;
+    return stat(name, &info) == 0 ? static_cast<long>(info.st_size) : -1;
+}
+
 //--------------------------------------------------
 // Main test driver
 int main()
 {
+    mkdir(UNIT_TEST_DIR, 0755);
+    if (chdir(UNIT_TEST_DIR) != 0)
+    {
+        std::cout << "Cannot enter " << UNIT_TEST_DIR << "\n";
+        return 1;
+    }
     std::string testFile = "testreservations.dat";
+    std::remove(testFile.c_str());
     std::cout << "Running unit test for ReservationFileIO on " << testFile << "\n";
 
     // Open test file
@@ -66,44 +260,491 @@ int main()
     bool save1 = saveReservation(rec1);
     bool save2 = saveReservation(rec2);
 
-    std::cout << "Test 1: saveReservation() - ";
-    if (save1 && save2)
-        std::cout << "PASS\n";
-    else
-        std::cout << "FAIL\n";
+    report(1, "saveReservation()", save1 && save2);
 
     // Retrieve rec1
     ReservationRecord loaded1;
     bool get1 = getReservation("ABC123", "S00-123-131", loaded1);
 
-    std::cout << "Test 2: getReservation(rec1) - ";
-    if (get1 && recordsEqual(rec1, loaded1))
-        std::cout << "PASS\n";
-    else
-        std::cout << "FAIL\n";
+    report(2, "getReservation(rec1)", get1 && recordsEqual(rec1, loaded1));
 
     // Retrieve rec2
     ReservationRecord loaded2;
     bool get2 = getReservation("XYZ789", "S00-321-134", loaded2);
 
-    std::cout << "Test 3: getReservation(rec2) - ";
-    if (get2 && recordsEqual(rec2, loaded2))
-        std::cout << "PASS\n";
-    else
-        std::cout << "FAIL\n";
+    report(3, "getReservation(rec2)", get2 && recordsEqual(rec2, loaded2));
 
     // Try to get a non-existent record
     ReservationRecord dummy;
     bool get3 = getReservation("DOESNOT", "EXIST", dummy);
 
-    std::cout << "Test 4: getReservation(non-existent) - ";
-    if (!get3)
-        std::cout << "PASS\n";
-    else
-        std::cout << "FAIL\n";
+    report(4, "getReservation(non-existent)", !get3);
+
+    // Batch save: update rec1 in place and append rec3 with one call
+    ReservationRecord rec1Onboard = rec1;
+    rec1Onboard.onboard = true;
+
+    ReservationRecord rec3 = {};
+    std::strncpy(rec3.licensePlate, "LMN456", LICENSE_PLATE_MAX);
+    std::strncpy(rec3.sailingID, "S00-555-1", SAILING_ID_MAX);
+    rec3.onboard = false;
+
+    std::vector<ReservationRecord> batch;
+    batch.push_back(rec1Onboard);
+    batch.push_back(rec3);
+    bool saveBatch = saveReservations(batch);
+
+    ReservationRecord loadedBatch1, loadedBatch3;
+    bool getBatch1 = getReservation("ABC123", "S00-123-131", loadedBatch1);
+    bool getBatch3 = getReservation("LMN456", "S00-555-1", loadedBatch3);
+
+    report(5, "saveReservations(update + append)",
+           saveBatch && getBatch1 && recordsEqual(rec1Onboard, loadedBatch1) &&
+           getBatch3 && recordsEqual(rec3, loadedBatch3));
+
+    // Bulk delete: remove everything on rec3's sailing in one pass
+    int deleted = deleteReservationsWhere([](const ReservationRecord &r)
+    {
+        return std::strncmp(r.sailingID, "S00-555-1", SAILING_ID_MAX) == 0;
+    });
+    ReservationRecord afterDelete;
+
+    report(6, "deleteReservationsWhere(sailing)",
+           deleted == 1 && !getReservation("LMN456", "S00-555-1", afterDelete) &&
+           getReservation("XYZ789", "S00-321-134", afterDelete) && recordsEqual(rec2, afterDelete));
+
+    // Overwriting a saved record touches only its own slot
+    IOCounts beforeSave = ioCountsFor("reservationFileIO::saveReservation");
+    bool resaved = saveReservation(rec2);
+    IOCounts saveIO = ioCountsFor("reservationFileIO::saveReservation") - beforeSave;
+
+    report(7, "saveReservation() storage I/O",
+           resaved && saveIO[IO_FULL_SCANS] == 0 && saveIO[IO_SEEKS] == 1 &&
+           saveIO[IO_FLUSHES] == 1 && saveIO[IO_REOPENS] == 0 &&
+           saveIO[IO_BYTES_WRITTEN] == sizeof(ReservationRecord));
+
+    close();
+
+    // Saving to a closed file fails and is counted as an error
+    LatencyStat &saveStat = latencyStat("reservationFileIO::saveReservation");
+    LatencySnapshot beforeFailed = saveStat.snapshot();
+    bool savedClosed = saveReservation(rec1);
+    LatencySnapshot afterFailed = saveStat.snapshot();
+    LatencySnapshot deleteStat = latencyStat("reservationFileIO::deleteReservationsWhere").snapshot();
+
+    report(8, "latency statistics",
+           !savedClosed && afterFailed.calls == beforeFailed.calls + 1 &&
+           afterFailed.errors == beforeFailed.errors + 1 &&
+           deleteStat.calls == 1 && deleteStat.errors == 0 &&
+           deleteStat.percentileMicros(0.5) <= deleteStat.maxNanos / 1000.0);
+
+    // Lane check-in against real stores: one grouped onboard write,
+    // a fare per plate from the registered vehicle, and an error
+    // for plates without a booking or listed twice
+    openEmptyStores();
+    const std::string lane = "TSW-01-08";
+    Vehicle regular, special;
+    bool ready = Sailing::addSailing(lane.c_str(), "Spirit", 200, 200) &&
+                 regular.addVehicle("REG001", "6045550001", 5.0f, 1.5f) &&
+                 special.addVehicle("SPC001", "6045550002", 10.0f, 3.0f) &&
+                 addReservation(lane, "REG001", "6045550001", false, 1.5f, 5.0f) &&
+                 addReservation(lane, "SPC001", "6045550002", true, 3.0f, 10.0f);
+
+    std::vector<std::string> plates;
+    plates.push_back("REG001");
+    plates.push_back("SPC001");
+    plates.push_back("NOPE01");
+    plates.push_back("REG001");
+    LatencySnapshot beforeOne = latencyStat("reservationFileIO::saveReservation").snapshot();
+    LatencySnapshot beforeMany = latencyStat("reservationFileIO::saveReservations").snapshot();
+    std::vector<CheckInResult> results = checkInBatch(lane, plates);
+    LatencySnapshot afterOne = latencyStat("reservationFileIO::saveReservation").snapshot();
+    LatencySnapshot afterMany = latencyStat("reservationFileIO::saveReservations").snapshot();
+
+    float regularFare = calculateFare(false, 5.0f, 1.5f);
+    float specialFare = calculateFare(true, 10.0f, 3.0f);
+    ReservationRecord regularRec, specialRec;
+    Sailing checked = Sailing::getSailingFromIO(lane.c_str());
+    report(9, "checkInBatch()",
+           ready && results.size() == 4 &&
+           results[0].licensePlate == "REG001" && results[0].error.empty() && results[0].fare == regularFare &&
+           results[1].licensePlate == "SPC001" && results[1].error.empty() && results[1].fare == specialFare &&
+           results[2].fare < 0.0f && !results[2].error.empty() &&
+           results[3].fare < 0.0f && !results[3].error.empty() &&
+           afterMany.calls == beforeMany.calls + 1 && afterOne.calls == beforeOne.calls &&
+           getReservation("REG001", lane, regularRec) && regularRec.onboard &&
+           getReservation("SPC001", lane, specialRec) && specialRec.onboard &&
+           checked.getOnboardCount() == 2 && checked.getRevenue() == regularFare + specialFare);
+
+    // Rescheduling a booked sailing moves its reservations and
+    // their counters, revenue and space to the new ID exactly once
+    openEmptyStores();
+    const std::string before = "RSA-02-09";
+    const std::string after = "RSA-03-09";
+    Vehicle moved, movedSpecial;
+    bool booked = Sailing::addSailing(before.c_str(), "Spirit", 200, 200) &&
+                  moved.addVehicle("MOV001", "6045550003", 5.0f, 1.5f) &&
+                  movedSpecial.addVehicle("MOV002", "6045550004", 9.0f, 2.5f) &&
+                  addReservation(before, "MOV001", "6045550003", false, 1.5f, 5.0f) &&
+                  addReservation(before, "MOV002", "6045550004", true, 2.5f, 9.0f) &&
+                  checkIn(before, "MOV002", true, 2.5f, 9.0f) > 0.0f;
+    Sailing old = Sailing::getSailingFromIO(before.c_str());
+    bool rescheduled = Sailing::applyEdit(before.c_str(), after.c_str(), "Spirit", 200, 200);
+    Sailing renamed = Sailing::getSailingFromIO(after.c_str());
+    float movedFare = calculateFare(true, 9.0f, 2.5f);
+
+    report(10, "applyEdit(reschedule) counters",
+           booked && rescheduled && !sailingFileIO::exists(before.c_str()) &&
+           renamed.getReservedCount() == 2 && renamed.getSpecialCount() == 1 &&
+           renamed.getOnboardCount() == 1 && renamed.getRevenue() == movedFare &&
+           old.getReservedCount() == 2 && old.getRevenue() == movedFare &&
+           renamed.getLRL() == old.getLRL() && renamed.getHRL() == old.getHRL() &&
+           getAllOnSailing(after).size() == 2 && auditStores(false).mismatched.empty());
+
+    // Cancelling an onboard reservation takes its fare off the revenue
+    bool cancelled = cancelReservation(after, "MOV002");
+    Sailing afterCancel = Sailing::getSailingFromIO(after.c_str());
+
+    report(11, "cancelReservation(onboard) refunds",
+           cancelled && afterCancel.getReservedCount() == 1 && afterCancel.getSpecialCount() == 0 &&
+           afterCancel.getOnboardCount() == 0 && afterCancel.getRevenue() == 0.0f &&
+           auditStores(false).mismatched.empty());
+
+    shutdown();
+    Sailing::shutdown();
+
+    // Both fare kernels price every vehicle exactly as
+    // calculateFare() does, to the cent: thresholds, regular and
+    // special vehicles, large values and random ones. The count is
+    // not a multiple of eight, so the vector kernel's tail runs too.
+    std::vector<float> specialFlag, lengths, heights;
+    const float edgeLengths[] = {0.1f, 6.9f, 7.0f, 7.1f, 12.5f, 99.9f, 1000.0f, 20000.0f};
+    const float edgeHeights[] = {0.5f, 1.9f, 2.0f, 2.0000002f, 2.1f, 4.0f, 50.0f};
+    // Loop goal: Add each threshold and large combination as regular and special
+    for (float l : edgeLengths)
+    {
+        for (float h : edgeHeights)
+        {
+            for (int flag = 0; flag < 2; ++flag)
+            {
+                specialFlag.push_back(static_cast<float>(flag));
+                lengths.push_back(l);
+                heights.push_back(h);
+            }
+        }
+    }
+    std::mt19937 random(37);
+    std::uniform_real_distribution<float> randomLength(0.1f, 30.0f);
+    std::uniform_real_distribution<float> randomHeight(0.5f, 6.0f);
+    // Loop goal: Add random vehicles
+    for (int i = 0; i < 1003; ++i)
+    {
+        specialFlag.push_back(random() % 2 == 0 ? 1.0f : 0.0f);
+        lengths.push_back(randomLength(random));
+        heights.push_back(randomHeight(random));
+    }
+
+    size_t vehicleCount = specialFlag.size();
+    std::vector<int32_t> dispatched(vehicleCount), portable(vehicleCount);
+    computeFareCents(specialFlag.data(), lengths.data(), heights.data(), dispatched.data(), vehicleCount);
+    computeFareCentsPortable(specialFlag.data(), lengths.data(), heights.data(), portable.data(), vehicleCount);
+    size_t wrongFares = 0;
+    // Loop goal: Compare both kernels with calculateFare() for each vehicle
+    for (size_t i = 0; i < vehicleCount; ++i)
+    {
+        int32_t expected = fareToCents(calculateFare(specialFlag[i] != 0.0f, lengths[i], heights[i]));
+        if (dispatched[i] != expected || portable[i] != expected)
+            ++wrongFares;
+    }
+
+    std::string kernelCase = std::string("computeFareCents(") + (fareKernelUsesAVX2() ? "avx2" : "scalar") +
+                             " + portable) matches calculateFare()";
+    report(12, kernelCase.c_str(), wrongFares == 0);
+
+    // The phone index follows every vehicle change: a second plate
+    // on a phone, a phone change, a rename and a delete
+    openEmptyStores();
+    Vehicle phoneFirst, phoneSecond;
+    std::vector<std::string> shared;
+    shared.push_back("PHN001");
+    shared.push_back("PHN002");
+    bool phoneSaved = phoneFirst.addVehicle("PHN001", "6045551000", 5.0f, 1.5f) &&
+                 phoneSecond.addVehicle("PHN002", "6045551000", 5.0f, 1.5f);
+    bool savedListed = platesForPhone("604-555-1000") == shared;
+    bool phoneChanged = updateVehicle("PHN001", "6045552000", 5.0f, 1.5f);
+    bool changedListed = platesForPhone("6045551000") == std::vector<std::string>(1, "PHN002") &&
+                         platesForPhone("6045552000") == std::vector<std::string>(1, "PHN001");
+    bool phoneRenamed = renameVehicle("PHN002", "PHN003");
+    bool renamedListed = platesForPhone("6045551000") == std::vector<std::string>(1, "PHN003");
+    bool phoneDeleted = deleteVehicle("PHN003");
+    bool removedListed = platesForPhone("6045551000").empty() &&
+                         platesForPhone("6045552000") == std::vector<std::string>(1, "PHN001");
+
+    report(13, "phone index save/change/rename/delete",
+           phoneSaved && savedListed && phoneChanged && changedListed && phoneRenamed && renamedListed &&
+           phoneDeleted && removedListed);
+
+    // An index loaded by an earlier open() is checked again when the
+    // vehicle file is replaced behind it
+    std::remove("vehicles.dat");
+    report(14, "phone index revalidated on open()", platesForPhone("6045552000").empty());
+
+    // Phone changes append to the log, which is compacted once the
+    // tombstones outnumber the live entries: 200 changes of one
+    // vehicle's phone leave a log of a few dozen entries
+    const long PHONE_LOG_ENTRY_BYTES = 15 + 11 + 1; // phone, licence, live flag
+    openEmptyStores();
+    Vehicle churned;
+    bool churnSaved = churned.addVehicle("CMP001", "6045554000", 5.0f, 1.5f);
+    // Loop goal: Move the vehicle between two phones
+    for (int i = 1; i <= 200 && churnSaved; ++i)
+    {
+        churnSaved = updateVehicle("CMP001", i % 2 == 1 ? "6045555000" : "6045554000", 5.0f, 1.5f);
+    }
+    long logBytes = fileBytes("phoneIndex.dat");
+
+    report(15, "phone index log compaction",
+           churnSaved && logBytes > 0 && logBytes < 100 * PHONE_LOG_ENTRY_BYTES &&
+           platesForPhone("6045554000") == std::vector<std::string>(1, "CMP001") &&
+           platesForPhone("6045555000").empty());
+
+    // Plate searches: the empty prefix lists every plate, the limit
+    // keeps the first ones in order, and case is ignored
+    openEmptyStores();
+    const char *trialPlates[] = {"XYZ999", "ABC102", "ABC100", "ABD101", "ABC101", "ABD100"};
+    bool trialSaved = true;
+    // Loop goal: Register each trial plate
+    for (size_t i = 0; i < sizeof(trialPlates) / sizeof(trialPlates[0]); ++i)
+    {
+        Vehicle trial;
+        trialSaved = trial.addVehicle(trialPlates[i], "6045556000", 5.0f, 1.5f) && trialSaved;
+    }
+    std::vector<std::string> everyPlate = platesWithPrefix("", 0);
+    std::vector<std::string> abcPlates = platesWithPrefix("abc", 0);
+    std::vector<std::string> firstTwo = platesWithPrefix("AB", 2);
+    bool prefixOk = everyPlate.size() == 6 && everyPlate.front() == "ABC100" && everyPlate.back() == "XYZ999" &&
+                    abcPlates.size() == 3 && abcPlates[2] == "ABC102" &&
+                    firstTwo.size() == 2 && firstTwo[0] == "ABC100" && firstTwo[1] == "ABC101";
+
+    report(16, "findPlatesWithPrefix(empty, prefix, limit)", trialSaved && prefixOk);
+
+    // Fuzzy searches at distance 0, 1 and 2, closest first
+    bool distanceOk = similarPlates("ABC100", 0) == "ABC100/0" &&
+                      similarPlates("ABC100", 1) == "ABC100/0 ABC101/1 ABC102/1 ABD100/1" &&
+                      similarPlates("abc100", 2) == "ABC100/0 ABC101/1 ABC102/1 ABD100/1 ABD101/2";
 
+    report(17, "findSimilarPlates(distance 0/1/2)", distanceOk);
+
+    // A deleted plate leaves both searches, and a replaced vehicle
+    // file is picked up on the next open()
+    bool trialDeleted = deleteVehicle("ABC101");
+    std::vector<std::string> abcAfterDelete = platesWithPrefix("ABC", 0);
+    bool deleteOk = trialDeleted && abcAfterDelete.size() == 2 && abcAfterDelete[1] == "ABC102" &&
+                    similarPlates("ABC101", 0).empty();
+    std::remove("vehicles.dat");
+    bool replaceOk = platesWithPrefix("", 0).empty() && similarPlates("ABC100", 2).empty();
+
+    report(18, "plate trie after delete and file replacement", deleteOk && replaceOk);
+
+    // exists() follows a vehicle file replaced by another with the
+    // same number of records, as an import or restore would leave it
+    openEmptyStores();
+    Vehicle original;
+    bool originalSaved = original.addVehicle("OLD001", "6045557000", 5.0f, 1.5f);
+    bool replaced = replaceInVehicleFile("OLD001", "NEW001");
+    bool oldListed = true, newListed = false;
+    FileIOforVehicle replacedIO;
+    if (replacedIO.open())
+    {
+        oldListed = replacedIO.exists("OLD001");
+        newListed = replacedIO.exists("NEW001");
+        replacedIO.close();
+    }
+
+    report(19, "exists() after same-size file replacement",
+           originalSaved && replaced && !oldListed && newListed);
+
+    shutdown();
+    Sailing::shutdown();
+
+    // An overwrite in place that cannot be written fails and counts
+    // as an error. The store's descriptor is swapped for a read-only
+    // one on the same file, so the flush of the overwrite fails.
+    const char *failFile = "failed_save.dat";
+    std::remove(failFile);
+    ReservationRecord kept = {};
+    std::strncpy(kept.licensePlate, "RDO001", LICENSE_PLATE_MAX);
+    std::strncpy(kept.sailingID, "S00-777-1", SAILING_ID_MAX);
+    bool failOpened = open(failFile);
+    bool appendSaved = failOpened && saveReservation(kept);
+    int storeFd = descriptorOf(failFile);
+    int readOnly = ::open(failFile, O_RDONLY);
+    bool swapped = storeFd >= 0 && readOnly >= 0 && dup2(readOnly, storeFd) == storeFd;
+    if (readOnly >= 0)
+        ::close(readOnly);
+    LatencySnapshot beforeOverwrite = saveStat.snapshot();
+    kept.onboard = true;
+    bool overwriteSaved = saveReservation(kept);
+    LatencySnapshot afterOverwrite = saveStat.snapshot();
+    close();
+    std::remove(failFile);
+
+    report(20, "saveReservation(failed overwrite) counts an error",
+           appendSaved && swapped && !overwriteSaved &&
+           afterOverwrite.calls == beforeOverwrite.calls + 1 &&
+           afterOverwrite.errors == beforeOverwrite.errors + 1);
+
+    // Phone lookups follow a vehicle file replaced by another of the
+    // same size in which a vehicle's phone changed
+    openEmptyStores();
+    Vehicle restored;
+    bool restoredSaved = restored.addVehicle("RST001", "6045558000", 5.0f, 1.5f);
+    bool listedBefore = platesForPhone("6045558000") == std::vector<std::string>(1, "RST001");
+    bool phoneReplaced = replaceInVehicleFile("6045558000", "6045559000");
+
+    report(21, "phone index after same-size file replacement",
+           restoredSaved && listedBefore && phoneReplaced &&
+           platesForPhone("6045558000").empty() &&
+           platesForPhone("6045559000") == std::vector<std::string>(1, "RST001"));
+
+    // An edit that keeps the sailing ID cannot shrink the lanes below
+    // the space already taken, and leaves the sailing as it was
+    const std::string shrunk = "SHR-04-10";
+    bool shrinkBooked = Sailing::addSailing(shrunk.c_str(), "Spirit", 100, 100) &&
+                        addReservation(shrunk, "SHR001", "6045550005", true, 3.0f, 20.0f);
+    Sailing beforeShrink = Sailing::getSailingFromIO(shrunk.c_str());
+    bool lowShrunk = Sailing::applyEdit(shrunk.c_str(), shrunk.c_str(), "Spirit", 10, 100);
+    bool highShrunk = Sailing::applyEdit(shrunk.c_str(), shrunk.c_str(), "Spirit", 100, 2);
+    bool fitted = Sailing::applyEdit(shrunk.c_str(), shrunk.c_str(), "Spirit", 20, 3);
+    Sailing afterShrink = Sailing::getSailingFromIO(shrunk.c_str());
+
+    report(22, "applyEdit() refuses lanes shorter than the space taken",
+           shrinkBooked && !lowShrunk && !highShrunk && fitted &&
+           beforeShrink.getLRL() == 80.0f && beforeShrink.getHRL() == 97.0f &&
+           afterShrink.getLRL() == 0.0f && afterShrink.getHRL() == 0.0f &&
+           afterShrink.getReservedCount() == 1);
+
+    shutdown();
+    Sailing::shutdown();
+
+    // A move whose writes fail changes nothing, in the index or on
+    // disk. The store's descriptor is swapped for a read-only one,
+    // as in test 20.
+    const char *moveFile = "failed_move.dat";
+    const std::string moveFrom = "MVA-05-11";
+    const std::string moveTo = "MVB-05-11";
+    std::remove(moveFile);
+    ReservationRecord moveA = {}, moveB = {};
+    std::strncpy(moveA.licensePlate, "MVF001", LICENSE_PLATE_MAX);
+    std::strncpy(moveB.licensePlate, "MVF002", LICENSE_PLATE_MAX);
+    std::strncpy(moveA.sailingID, moveFrom.c_str(), SAILING_ID_MAX);
+    std::strncpy(moveB.sailingID, moveFrom.c_str(), SAILING_ID_MAX);
+    bool moveSaved = open(moveFile) && saveReservation(moveA) && saveReservation(moveB);
+    int moveFd = descriptorOf(moveFile);
+    int moveReadOnly = ::open(moveFile, O_RDONLY);
+    bool moveSwapped = moveFd >= 0 && moveReadOnly >= 0 && dup2(moveReadOnly, moveFd) == moveFd;
+    if (moveReadOnly >= 0)
+        ::close(moveReadOnly);
+    int movedCount = moveAllOnSailing(moveFrom, moveTo);
+    // the stream can't read past its failed writes, so ask the index alone
+    bool indexKept = exists("MVF001", moveFrom) && exists("MVF002", moveFrom) &&
+                     !exists("MVF001", moveTo) && !exists("MVF002", moveTo);
+    close();
+    bool diskKept = open(moveFile) && getAllOnSailing(moveFrom).size() == 2 &&
+                    getAllOnSailing(moveTo).empty();
     close();
-    std::cout << "All tests complete.\n";
+    std::remove(moveFile);
+
+    report(23, "moveAllOnSailing(failed write) changes nothing",
+           moveSaved && moveSwapped && movedCount == -1 && indexKept && diskKept);
+
+    // Deleting a sailing's reservations leaves the sailing empty:
+    // counters, deck space and the revenue of checked-in vehicles
+    openEmptyStores();
+    const std::string cleared = "CLR-06-12";
+    Vehicle clearedVehicle;
+    bool clearBooked = Sailing::addSailing(cleared.c_str(), "Spirit", 100, 100) &&
+                       clearedVehicle.addVehicle("CLR001", "6045550006", 9.0f, 2.5f) &&
+                       addReservation(cleared, "CLR001", "6045550006", true, 2.5f, 9.0f) &&
+                       addReservation(cleared, "CLR002", "6045550007", false, 0.0f, 0.0f) &&
+                       checkIn(cleared, "CLR001", true, 2.5f, 9.0f) > 0.0f;
+    int clearedCount = deleteAllOnSailing(cleared);
+    Sailing emptied = Sailing::getSailingFromIO(cleared.c_str());
+
+    report(24, "deleteAllOnSailing() clears counters, space and revenue",
+           clearBooked && clearedCount == 2 && emptied.getReservedCount() == 0 &&
+           emptied.getSpecialCount() == 0 && emptied.getOnboardCount() == 0 &&
+           emptied.getRevenue() == 0.0f && emptied.getLRL() == 100.0f && emptied.getHRL() == 100.0f &&
+           auditStores(false).mismatched.empty());
+
+    // Check-in charges what the registered vehicle costs, whatever
+    // dimensions the caller passes in
+    openEmptyStores();
+    const std::string priced = "FAR-07-08";
+    Vehicle pricedVehicle;
+    bool priceBooked = Sailing::addSailing(priced.c_str(), "Spirit", 100, 100) &&
+                       pricedVehicle.addVehicle("FAR001", "6045550008", 9.0f, 2.5f) &&
+                       addReservation(priced, "FAR001", "6045550008", true, 2.5f, 9.0f);
+    float pricedFare = checkIn(priced, "FAR001", false, 0.0f, 0.0f);
+
+    report(25, "checkIn() prices from the registered vehicle",
+           priceBooked && pricedFare == calculateFare(true, 9.0f, 2.5f) &&
+           pricedFare != calculateFare(false, 0.0f, 0.0f) &&
+           Sailing::getSailingFromIO(priced.c_str()).getRevenue() == pricedFare);
+
+    // A sailing file written with the old 52-byte record (no
+    // counters or revenue) is refused instead of read as garbage
+    shutdown();
+    Sailing::shutdown();
+    std::remove("sailingData.dat");
+    std::ofstream oldFile("sailingData.dat", std::ios::binary);
+    // Loop goal: Write old-layout records, enough to fill whole new-size records
+    for (int i = 0; i < 17; ++i)
+    {
+        char oldRecord[52];
+        std::memset(oldRecord, 0, sizeof(oldRecord));
+        std::snprintf(oldRecord, 10, "OLD-01-%02d", i);
+        std::snprintf(oldRecord + 10, 26, "Vessel%d", i);
+        int lanes[2] = {100, 100};
+        float remaining[2] = {100.0f, 100.0f};
+        std::memcpy(oldRecord + 36, lanes, sizeof(lanes));
+        std::memcpy(oldRecord + 44, remaining, sizeof(remaining));
+        oldFile.write(oldRecord, sizeof(oldRecord));
+    }
+    oldFile.close();
+    bool oldOpened = sailingFileIO::openFile();
+    bool oldEmpty = sailingFileIO::reportRows().empty() && !sailingFileIO::exists("OLD-01-00");
+    sailingFileIO::closeFile();
+
+    report(26, "openFile() refuses an old-layout sailing file",
+           !oldOpened && oldEmpty && fileBytes("sailingData.dat") == 17 * 52);
+    std::remove("sailingData.dat");
+
+    // An edit that keeps the sailing ID and can't be written leaves
+    // the sailing as it was, in the table and on disk
+    openEmptyStores();
+    const std::string edited = "EDT-08-09";
+    bool editAdded = Sailing::addSailing(edited.c_str(), "Spirit", 100, 100);
+    int editFd = descriptorOf("sailingData.dat");
+    int editReadOnly = ::open("sailingData.dat", O_RDONLY);
+    bool editSwapped = editFd >= 0 && editReadOnly >= 0 && dup2(editReadOnly, editFd) == editFd;
+    if (editReadOnly >= 0)
+        ::close(editReadOnly);
+    bool editApplied = Sailing::applyEdit(edited.c_str(), edited.c_str(), "Other", 120, 120);
+    bool editKeptInTable = sailingFileIO::exists(edited.c_str()) &&
+                           std::string(sailingFileIO::getSailing(edited.c_str()).getVesselID()) == "Spirit";
+    Sailing::shutdown();
+    Sailing::initialize();
+    bool editKeptOnDisk = sailingFileIO::exists(edited.c_str()) &&
+                          std::string(sailingFileIO::getSailing(edited.c_str()).getVesselID()) == "Spirit";
+
+    report(27, "applyEdit(same ID, failed write) keeps the sailing",
+           editAdded && editSwapped && !editApplied && editKeptInTable && editKeptOnDisk);
+
+    shutdown();
+    Sailing::shutdown();
+
+    std::cout << (failures == 0 ? "All tests complete.\n" : "Some tests failed.\n");
 
-    return 0;
+    return failures == 0 ? 0 : 1;
 }
\ No newline at end of file
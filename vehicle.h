@@ -9,7 +9,9 @@
 //************************************************************
 // USAGE:
 // - Call initialize() to set up a Vehicle instance.
-// - Use addVehicle()/editVehicle() for persistence operations.
+// - Use addVehicle()/editVehicle() for persistence operations,
+//   and renameVehicle()/updateVehicle()/deleteVehicle() to
+//   change a vehicle by plate.
 // - Query isSpecial(), getLength(), or getHeight() as needed.
 //************************************************************
 // REVISION HISTORY:
@@ -18,6 +20,11 @@
 // Rev. 2 - 2025/08/05 - James Nguyen
 //          - Finalized interface and aligned with .cpp
 // implementation.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - addVehicle()/editVehicle() return a status instead of
+//            printing it; added renameVehicle(), updateVehicle()
+//            and deleteVehicle(). The UI functions moved to
+//            vehicleMenu.h.
 //************************************************************
 // in: Represents input parameter
 // out: Represents output parameter
@@ -62,11 +69,13 @@ public:
     void shutdown();
 
     // Adds a Vehicle record with the given attributes.
+    // Returns false if the plate is already registered or the
+    // record could not be saved.
     // in: newLicence – null‐terminated license string
     // in: newPhone   – null‐terminated phone string
     // in: newLength  – length in meters
     // in: newHeight  – height in meters
-    void addVehicle(
+    bool addVehicle(
         const char* newLicence,
         const char* newPhone,
         float newLength,
@@ -74,11 +83,12 @@ public:
     );
 
     // Edits this Vehicle's information.
+    // Returns false if the record could not be saved.
     // in: newLicence – new license string
     // in: newPhone   – new phone string
     // in: newLength  – new length in meters
     // in: newHeight  – new height in meters
-    void editVehicle(
+    bool editVehicle(
         const char* newLicence,
         const char* newPhone,
         float newLength,
@@ -97,17 +107,32 @@ public:
 };
 
 //--------------------------------------------------
-// Utility functions for vehicle management UI
+// Vehicle operations by license plate. None of them prompt
+// or print; the screens are in vehicleMenu.h.
 //--------------------------------------------------
 
-// Handles adding a vehicle through user interface
-// Returns true if successful, false if cancelled or failed
-bool addVehicleFromUI();
+// Moves a registered vehicle to a new license plate.
+// Returns false if the vehicle is missing or the new plate
+// is taken.
+// in: licence    – current license plate
+// in: newLicence – license plate after the change
+bool renameVehicle(const std::string& licence, const std::string& newLicence);
 
-// Handles editing a vehicle through user interface
-// in: licencePlate – license plate of vehicle to edit
-// Returns true if successful, false if cancelled or failed
-bool editVehicleFromUI(const std::string& licencePlate);
+// Saves new contact details and dimensions for a vehicle
+// under its license plate.
+// Returns false if the record could not be saved.
+// in: licence – license plate
+// in: phone   – phone number
+// in: length  – length in meters
+// in: height  – height in meters
+bool updateVehicle(const std::string& licence, const std::string& phone,
+                   float length, float height);
+
+// Deletes a registered vehicle.
+// Returns false if the vehicle is missing or could not be
+// deleted.
+// in: licence – license plate
+bool deleteVehicle(const std::string& licence);
 
 
 #endif // VEHICLE_H
\ No newline at end of file
@@ -15,13 +15,46 @@
 // Rev. 2 - 2025/08/05 - James Nguyen
 //          - Finalized interface and aligned with .cpp 
 //          implementation.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Batched whole-file reads, getVehicles() and the
+//          getManifest() hash join.
+//          - Persisted phone index and phone lookups.
+//          - Plate trie for prefix and fuzzy plate searches.
+//          - saveVehicles() batch save.
+//          - bulkLoad() for generated data.
+//          - Plate slot index for single-record lookups and updates.
+//          - Store operations record latency statistics.
+//          - Flushes go through flushRecords() for the span trace.
+//          - Record reads and writes, seeks and file opens are
+//            counted in the storage I/O counters.
+// Rev. 4 - 2026/10/18 - Group 19
+//          - The phone index is checked against the files on every
+//            open(), not only the first.
+//          - So are the plate trie and slots: they are rebuilt when
+//            the vehicle file's size, modification time or inode
+//            differ from those they were built from, so exists()
+//            and single-record lookups never use a replaced file's
+//            slots.
+//          - The phone index is checked against the same file
+//            stamp, so phone lookups never list a replaced file's
+//            plates.
 //************************************************************
 
 
 #include "vehicleFileIO.h"
+#include "latencyStats.h"
+#include "plateTrie.h"
+#include "ioStats.h"
+#include "recordIO.h"
+#include "reservationFileIO.h"
+#include "threadPool.h"
 #include <iostream>
 #include <fstream>
+#include <cctype>
 #include <cstring>
+#include <set>
+#include <unordered_set>
+#include <sys/stat.h>
 
 using namespace std;
 
@@ -29,6 +62,7 @@ using namespace std;
 // Constants for file operations
 //--------------------------------------------------
 const string VEHICLE_DATA_FILE = "vehicles.dat";
+const string PHONE_INDEX_FILE = "phoneIndex.dat";
 
 //--------------------------------------------------
 // Binary record structure for Vehicle data
@@ -79,6 +113,284 @@ namespace {
         return vehicle;
     }
     
+    
+    //--------------------------------------------------
+    // File stamps: the phone index, plate trie and plate slots each
+    // remember the vehicle file they were built from, and are
+    // rebuilt when it has changed under them (e.g. replaced by an
+    // import or restore).
+    //--------------------------------------------------
+    
+    // Identifies one state of the vehicle file: its size,
+    // modification time and inode
+    struct FileStamp {
+        long long bytes;
+        long long modifiedNs;
+        unsigned long long inode;
+        
+        bool operator==(const FileStamp& other) const {
+            return bytes == other.bytes && modifiedNs == other.modifiedNs && inode == other.inode;
+        }
+    };
+    FileStamp phoneIndexStamp = {-1, 0, 0}; // vehicle file the phone index reflects
+    FileStamp plateIndexStamp = {-1, 0, 0}; // vehicle file the trie and slots reflect
+    
+    // Returns the vehicle file's stamp; bytes is -1 if it is missing
+    FileStamp vehicleFileStamp() {
+        FileStamp stamp = {-1, 0, 0};
+        struct stat info;
+        if (stat(VEHICLE_DATA_FILE.c_str(), &info) == 0) {
+            stamp.bytes = static_cast<long long>(info.st_size);
+            stamp.modifiedNs = static_cast<long long>(info.st_mtim.tv_sec) * 1000000000LL + info.st_mtim.tv_nsec;
+            stamp.inode = static_cast<unsigned long long>(info.st_ino);
+        }
+        return stamp;
+    }
+    
+    // Marks the phone index, trie and slots as reflecting the file
+    // as it is now. Called after each write that kept them in step.
+    void stampVehicleIndexes() {
+        FileStamp stamp = vehicleFileStamp();
+        phoneIndexStamp = stamp;
+        plateIndexStamp = stamp;
+    }
+    
+    //--------------------------------------------------
+    // Phone index: an append-only log of (phone, licence) entries
+    // in PHONE_INDEX_FILE, replayed into a map at first use. A
+    // change of phone appends a tombstone for the old pair and a
+    // live entry for the new one, so edits never rewrite the file;
+    // the log is compacted once tombstones outnumber live entries.
+    //--------------------------------------------------
+    
+    // One entry of the phone index log
+    struct PhoneIndexEntry {
+        char phone[15];      // Phone key (digits only)
+        char licence[11];    // License plate
+        bool live;           // False for a tombstone
+    };
+    
+    // Phone key -> plates registered to it
+    unordered_map<string, set<string> > phoneIndex;
+    bool phoneIndexLoaded = false;
+    long phoneIndexEntries = 0;  // entries in the log, tombstones included
+    long phoneIndexLive = 0;     // (phone, plate) pairs in the map
+    
+    // Reduces a phone number to its digits so "604-555-1234" and
+    // "(604) 555 1234" share a key; numbers without digits are
+    // kept as typed.
+    string phoneKey(const string& phone) {
+        string key;
+        // Loop goal: Keep only the digits
+        for (char c : phone) {
+            if (isdigit(static_cast<unsigned char>(c))) {
+                key += c;
+            }
+        }
+        if (key.empty()) {
+            key = phone;
+        }
+        return key.substr(0, 14);
+    }
+    
+    // Applies one log entry to the in-memory index
+    void applyPhoneEntry(const string& key, const string& licence, bool live) {
+        if (live) {
+            if (phoneIndex[key].insert(licence).second) {
+                ++phoneIndexLive;
+            }
+        } else {
+            unordered_map<string, set<string> >::iterator plates = phoneIndex.find(key);
+            if (plates != phoneIndex.end() && plates->second.erase(licence) > 0) {
+                --phoneIndexLive;
+                if (plates->second.empty()) {
+                    phoneIndex.erase(plates);
+                }
+            }
+        }
+    }
+    
+    // Builds a log entry
+    PhoneIndexEntry makePhoneEntry(const string& key, const string& licence, bool live) {
+        PhoneIndexEntry entry;
+        memset(&entry, 0, sizeof(PhoneIndexEntry));
+        strncpy(entry.phone, key.c_str(), sizeof(entry.phone) - 1);
+        strncpy(entry.licence, licence.c_str(), sizeof(entry.licence) - 1);
+        entry.live = live;
+        return entry;
+    }
+    
+    // Rewrites the log with one live entry per pair in the map
+    void compactPhoneIndex() {
+        vector<PhoneIndexEntry> entries;
+        entries.reserve(phoneIndexLive);
+        // Loop goal: Emit a live entry for every phone/plate pair
+        for (const auto& plates : phoneIndex) {
+            for (const auto& licence : plates.second) {
+                entries.push_back(makePhoneEntry(plates.first, licence, true));
+            }
+        }
+        ofstream out(PHONE_INDEX_FILE, ios::out | ios::binary | ios::trunc);
+        countIO(IO_REOPENS);
+        writeAllRecords(out, entries);
+        phoneIndexEntries = static_cast<long>(entries.size());
+    }
+    
+    // Applies a batch of entries and appends them to the log in
+    // one write (or compacts the log instead once it has grown)
+    void appendPhoneEntries(const vector<PhoneIndexEntry>& entries) {
+        if (entries.empty()) {
+            return;
+        }
+        // Loop goal: Apply each entry to the map
+        for (const auto& entry : entries) {
+            applyPhoneEntry(entry.phone, entry.licence, entry.live);
+        }
+        
+        if (phoneIndexEntries + static_cast<long>(entries.size()) > 2 * phoneIndexLive + 64) {
+            compactPhoneIndex();
+            return;
+        }
+        ofstream out(PHONE_INDEX_FILE, ios::out | ios::binary | ios::app);
+        countIO(IO_REOPENS);
+        writeAllRecords(out, entries);
+        phoneIndexEntries += static_cast<long>(entries.size());
+    }
+    
+    // Appends one entry to the log and applies it
+    void appendPhoneEntry(const string& phone, const string& licence, bool live) {
+        appendPhoneEntries(vector<PhoneIndexEntry>(1, makePhoneEntry(phoneKey(phone), licence, live)));
+    }
+    
+    // Returns the number of records in the open vehicle file
+    long vehicleRecordCount(fstream& data) {
+        data.clear();
+        data.seekg(0, ios::end);
+        countIO(IO_SEEKS);
+        long count = static_cast<long>(data.tellg()) / static_cast<long>(sizeof(VehicleRecord));
+        data.clear();
+        return count;
+    }
+    
+    // Returns the number of entries in the log on disk, or -1 if
+    // there is no log
+    long phoneLogEntriesOnDisk() {
+        struct stat info;
+        if (stat(PHONE_INDEX_FILE.c_str(), &info) != 0) {
+            return -1;
+        }
+        return static_cast<long>(info.st_size) / static_cast<long>(sizeof(PhoneIndexEntry));
+    }
+    
+    // Loads the index from its log. Called by every open(): an
+    // index already in memory is kept while the vehicle file still
+    // has the stamp of the last write this process made to it and
+    // the log on disk is the one it wrote. A vehicle file that
+    // changed under a loaded index (e.g. replaced by one of the
+    // same size) rebuilds it from the file; otherwise the log is
+    // replayed, and the index rebuilt if the log is missing or
+    // does not hold one live pair per vehicle record.
+    void loadPhoneIndex(fstream& data, long vehicleCount) {
+        FileStamp stamp = vehicleFileStamp();
+        bool fileChanged = phoneIndexLoaded && !(stamp == phoneIndexStamp);
+        if (phoneIndexLoaded && !fileChanged && phoneLogEntriesOnDisk() == phoneIndexEntries) {
+            return;
+        }
+        phoneIndexLoaded = true;
+        phoneIndexStamp = stamp;
+        phoneIndex.clear();
+        phoneIndexLive = 0;
+        
+        if (!fileChanged) {
+            fstream log(PHONE_INDEX_FILE, ios::in | ios::binary);
+            if (log.is_open()) {
+                countIO(IO_REOPENS);
+            }
+            vector<PhoneIndexEntry> entries;
+            readAllRecords(log, entries);
+            phoneIndexEntries = static_cast<long>(entries.size());
+            // Loop goal: Replay the log in order
+            for (const auto& entry : entries) {
+                applyPhoneEntry(string(entry.phone, strnlen(entry.phone, sizeof(entry.phone))),
+                                string(entry.licence, strnlen(entry.licence, sizeof(entry.licence))),
+                                entry.live);
+            }
+            
+            if (log.is_open() && vehicleCount == phoneIndexLive) {
+                return;
+            }
+        }
+        
+        vector<VehicleRecord> records;
+        readAllRecords(data, records);
+        phoneIndex.clear();
+        phoneIndexLive = 0;
+        // Loop goal: Index every vehicle record by its phone
+        for (const auto& record : records) {
+            applyPhoneEntry(phoneKey(string(record.phone, strnlen(record.phone, sizeof(record.phone)))),
+                            string(record.licence, strnlen(record.licence, sizeof(record.licence))),
+                            true);
+        }
+        compactPhoneIndex();
+    }
+    
+    //--------------------------------------------------
+    // Plate trie and plate slots: every plate in the vehicle file,
+    // and the record slot holding it (the first, if repeated). Both
+    // are built from the file, updated as vehicles are added and
+    // deleted, and dropped together when the file changes under
+    // them.
+    //--------------------------------------------------
+    
+    PlateTrie plateTrie;
+    unordered_map<string, size_t> plateSlots;
+    bool plateTrieLoaded = false;
+    
+    // Rebuilds the plate slots from the records in file order
+    void indexPlateSlots(const vector<VehicleRecord>& records) {
+        plateSlots.clear();
+        plateSlots.reserve(records.size());
+        // Loop goal: Map each plate to its first slot
+        for (size_t i = 0; i < records.size(); ++i) {
+            plateSlots.insert(make_pair(string(records[i].licence,
+                                               strnlen(records[i].licence, sizeof(records[i].licence))), i));
+        }
+    }
+    
+    // Builds the plate trie and slots from the vehicle file. Called
+    // by every open(): an index already in memory is kept only
+    // while the file still has the stamp of the last write this
+    // process made to it, so a file replaced by another of the
+    // same size is caught too.
+    void loadPlateTrie(fstream& data) {
+        if (plateTrieLoaded && vehicleFileStamp() == plateIndexStamp) {
+            return;
+        }
+        plateTrieLoaded = true;
+        plateTrie.clear();
+        
+        vector<VehicleRecord> records;
+        readAllRecords(data, records);
+        // Loop goal: Add each vehicle's plate
+        for (const auto& record : records) {
+            plateTrie.insert(string(record.licence, strnlen(record.licence, sizeof(record.licence))));
+        }
+        indexPlateSlots(records);
+        plateIndexStamp = vehicleFileStamp();
+    }
+    
+    // Reads the record holding a plate. Returns false if the plate
+    // is not on file.
+    bool readPlateRecord(fstream& data, const string& licence, VehicleRecord& record, size_t& slot) {
+        unordered_map<string, size_t>::const_iterator found = plateSlots.find(licence);
+        if (found == plateSlots.end()) {
+            return false;
+        }
+        slot = found->second;
+        data.clear();
+        return readRecordAt(data, slot, record);
+    }
+    
 } // end anonymous namespace
 
 //--------------------------------------------------
@@ -86,9 +398,12 @@ namespace {
 //--------------------------------------------------
 
 bool FileIOforVehicle::open() {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::open");
+    LatencyTimer timer(stat);
     try {
         // Try to open file in binary read/write mode
         data.open(VEHICLE_DATA_FILE, ios::in | ios::out | ios::binary);
+        countIO(IO_REOPENS);
         
         if (!data.is_open()) {
             // File doesn't exist, create it
@@ -96,7 +411,7 @@ bool FileIOforVehicle::open() {
             data.open(VEHICLE_DATA_FILE, ios::out | ios::binary);
             if (!data.is_open()) {
                 cerr << "Error: Cannot create vehicle data file." << endl;
-                return false;
+                return timer.result(false);
             }
             data.close();
             
@@ -104,47 +419,43 @@ bool FileIOforVehicle::open() {
             data.open(VEHICLE_DATA_FILE, ios::in | ios::out | ios::binary);
             if (!data.is_open()) {
                 cerr << "Error: Cannot open vehicle data file for read/write." << endl;
-                return false;
+                return timer.result(false);
             }
         }
         
+        long vehicleCount = vehicleRecordCount(data);
+        loadPhoneIndex(data, vehicleCount);
+        loadPlateTrie(data);
         return true;
     } catch (const exception& e) {
         cerr << "Exception in FileIOforVehicle::open(): " << e.what() << endl;
-        return false;
+        return timer.result(false);
     }
 }
 
 bool FileIOforVehicle::close() {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::close");
+    LatencyTimer timer(stat);
     try {
         if (data.is_open()) {
             data.close();
         }
-        return !data.is_open();
+        return timer.result(!data.is_open());
     } catch (const exception& e) {
         cerr << "Exception in FileIOforVehicle::close(): " << e.what() << endl;
-        return false;
+        return timer.result(false);
     }
 }
 
 bool FileIOforVehicle::exists(const string &licence) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::exists");
+    LatencyTimer timer(stat);
     if (!data.is_open()) {
         return false;
     }
     
     try {
-        // Reset file position
-        data.clear();
-        data.seekg(0, ios::beg);
-        
-        VehicleRecord record;
-        while (data.read(reinterpret_cast<char*>(&record), sizeof(VehicleRecord))) {
-            if (string(record.licence) == licence) {
-                return true;
-            }
-        }
-        
-        return false;
+        return plateSlots.count(licence) > 0;
     } catch (const exception& e) {
         cerr << "Exception in FileIOforVehicle::exists(): " << e.what() << endl;
         return false;
@@ -152,6 +463,8 @@ bool FileIOforVehicle::exists(const string &licence) {
 }
 
 vector<Vehicle> FileIOforVehicle::getAllVehicles() {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::getAllVehicles");
+    LatencyTimer timer(stat);
     vector<Vehicle> vehicles;
     
     if (!data.is_open()) {
@@ -159,12 +472,11 @@ vector<Vehicle> FileIOforVehicle::getAllVehicles() {
     }
     
     try {
-        // Reset file position
-        data.clear();
-        data.seekg(0, ios::beg);
+        vector<VehicleRecord> records;
+        readAllRecords(data, records);
         
-        VehicleRecord record;
-        while (data.read(reinterpret_cast<char*>(&record), sizeof(VehicleRecord))) {
+        vehicles.reserve(records.size());
+        for (const auto& record : records) {
             string licence, phone;
             Vehicle vehicle = binaryRecordToVehicle(record, licence, phone);
             vehicles.push_back(vehicle);
@@ -178,6 +490,8 @@ vector<Vehicle> FileIOforVehicle::getAllVehicles() {
 }
 
 Vehicle FileIOforVehicle::getVehicle(const string &licence) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::getVehicle");
+    LatencyTimer timer(stat);
     Vehicle vehicle;
     
     if (!data.is_open()) {
@@ -185,16 +499,11 @@ Vehicle FileIOforVehicle::getVehicle(const string &licence) {
     }
     
     try {
-        // Reset file position
-        data.clear();
-        data.seekg(0, ios::beg);
-        
         VehicleRecord record;
-        while (data.read(reinterpret_cast<char*>(&record), sizeof(VehicleRecord))) {
-            if (string(record.licence) == licence) {
-                string licenceStr, phone;
-                return binaryRecordToVehicle(record, licenceStr, phone);
-            }
+        size_t slot;
+        if (readPlateRecord(data, licence, record, slot)) {
+            string licenceStr, phone;
+            return binaryRecordToVehicle(record, licenceStr, phone);
         }
         
         return vehicle; // Empty vehicle if not found
@@ -204,120 +513,408 @@ Vehicle FileIOforVehicle::getVehicle(const string &licence) {
     }
 }
 
+unordered_map<string, Vehicle> FileIOforVehicle::getVehicles(const vector<string> &licences) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::getVehicles");
+    LatencyTimer timer(stat);
+    unordered_map<string, Vehicle> found;
+    
+    if (!data.is_open() || licences.empty()) {
+        return found;
+    }
+    
+    try {
+        unordered_set<string> wanted(licences.begin(), licences.end());
+        
+        vector<VehicleRecord> records;
+        readAllRecords(data, records);
+        
+        // Loop goal: Probe each record against the wanted set until all are found
+        for (const auto& record : records) {
+            if (found.size() == wanted.size()) {
+                break;
+            }
+            string licenceStr(record.licence);
+            if (wanted.count(licenceStr) && !found.count(licenceStr)) {
+                string licenceOut, phone;
+                found[licenceStr] = binaryRecordToVehicle(record, licenceOut, phone);
+            }
+        }
+        
+        return found;
+    } catch (const exception& e) {
+        cerr << "Exception in FileIOforVehicle::getVehicles(): " << e.what() << endl;
+        return found;
+    }
+}
+
+vector<ManifestRow> FileIOforVehicle::getManifest(const string &sailingID) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::getManifest");
+    LatencyTimer timer(stat);
+    vector<ReservationRecord> reservations = getAllOnSailing(sailingID);
+    vector<ManifestRow> manifest(reservations.size());
+    
+    // Loop goal: Start every row as an unregistered vehicle
+    for (size_t i = 0; i < reservations.size(); ++i) {
+        ManifestRow &row = manifest[i];
+        row.licensePlate = string(reservations[i].licensePlate,
+                                  strnlen(reservations[i].licensePlate, LICENSE_PLATE_MAX));
+        row.onboard = reservations[i].onboard;
+        row.registered = false;
+        row.phone = "N/A";
+        row.isSpecial = false;
+        row.length = 0.0f;
+        row.height = 0.0f;
+    }
+    
+    if (!data.is_open() || manifest.empty()) {
+        return manifest;
+    }
+    
+    try {
+        vector<VehicleRecord> records;
+        readAllRecords(data, records);
+        
+        // Fills a row from the vehicle record it joined with
+        auto fill = [](ManifestRow &row, const VehicleRecord &record) {
+            row.registered = true;
+            row.phone = string(record.phone, strnlen(record.phone, sizeof(record.phone)));
+            row.isSpecial = record.special;
+            row.length = record.length;
+            row.height = record.height;
+        };
+        
+        if (records.size() < manifest.size()) {
+            // Fewer vehicles than reservations: hash the vehicles
+            unordered_map<string, size_t> byLicence;
+            // Loop goal: Index each vehicle record by plate, first one wins
+            for (size_t i = 0; i < records.size(); ++i) {
+                byLicence.insert(make_pair(
+                    string(records[i].licence, strnlen(records[i].licence, sizeof(records[i].licence))), i));
+            }
+            // Loop goal: Probe the vehicle table with each reservation
+            for (auto &row : manifest) {
+                unordered_map<string, size_t>::const_iterator hit = byLicence.find(row.licensePlate);
+                if (hit != byLicence.end()) {
+                    fill(row, records[hit->second]);
+                }
+            }
+        } else {
+            // Fewer reservations: hash the manifest rows and stream the vehicles past them
+            unordered_map<string, vector<size_t> > byPlate;
+            // Loop goal: Index each manifest row by plate
+            for (size_t i = 0; i < manifest.size(); ++i) {
+                byPlate[manifest[i].licensePlate].push_back(i);
+            }
+            // Loop goal: Probe the manifest table with each vehicle record
+            for (const auto &record : records) {
+                unordered_map<string, vector<size_t> >::iterator hit = byPlate.find(
+                    string(record.licence, strnlen(record.licence, sizeof(record.licence))));
+                if (hit == byPlate.end()) {
+                    continue;
+                }
+                // Loop goal: Fill every row for this plate
+                for (size_t i : hit->second) {
+                    fill(manifest[i], record);
+                }
+                byPlate.erase(hit); // first matching record wins
+                if (byPlate.empty()) {
+                    break;
+                }
+            }
+        }
+    } catch (const exception& e) {
+        cerr << "Exception in FileIOforVehicle::getManifest(): " << e.what() << endl;
+    }
+    
+    return manifest;
+}
+
 bool FileIOforVehicle::saveVehicle(const Vehicle &v) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::saveVehicle");
+    LatencyTimer timer(stat);
     // For basic save, we need license and phone. 
     // This is a simplified version - the caller should use saveVehicleWithData
-    return saveVehicleWithData(v, "UNKNOWN", v.getPhone());
+    return timer.result(saveVehicleWithData(v, "UNKNOWN", v.getPhone()));
 }
 
 bool FileIOforVehicle::saveVehicleWithData(const Vehicle &vehicle, 
                                            const string &licence, 
                                            const string &phone) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::saveVehicleWithData");
+    LatencyTimer timer(stat);
     if (!data.is_open()) {
-        return false;
+        return timer.result(false);
     }
     
     try {
         VehicleRecord record = vehicleToBinaryRecord(vehicle, licence, phone);
         
         // Check if vehicle already exists
-        if (exists(licence)) {
-            // Update existing record
+        VehicleRecord tempRecord;
+        size_t slot;
+        if (readPlateRecord(data, licence, tempRecord, slot)) {
+            // Found the record, overwrite it
             data.clear();
-            data.seekg(0, ios::beg);
-            
-            VehicleRecord tempRecord;
-            streampos position = 0;
-            
-            while (data.read(reinterpret_cast<char*>(&tempRecord), sizeof(VehicleRecord))) {
-                if (string(tempRecord.licence) == licence) {
-                    // Found the record, overwrite it
-                    data.seekp(position);
-                    data.write(reinterpret_cast<const char*>(&record), sizeof(VehicleRecord));
-                    data.flush();
-                    return true;
-                }
-                position = data.tellg();
+            writeRecordAt(data, slot, record);
+            flushRecords(data);
+            stampVehicleIndexes();
+            if (phoneKey(tempRecord.phone) != phoneKey(record.phone)) {
+                appendPhoneEntry(tempRecord.phone, licence, false);
+                appendPhoneEntry(record.phone, licence, true);
             }
+            return timer.result(data.good());
         } else {
             // Append new record
             data.clear();
             data.seekp(0, ios::end);
+            countIO(IO_SEEKS);
+            slot = static_cast<size_t>(data.tellp()) / sizeof(VehicleRecord);
             data.write(reinterpret_cast<const char*>(&record), sizeof(VehicleRecord));
-            data.flush();
-            return true;
+            countIO(IO_BYTES_WRITTEN, sizeof(VehicleRecord));
+            flushRecords(data);
+            appendPhoneEntry(record.phone, record.licence, true);
+            plateTrie.insert(record.licence);
+            plateSlots.insert(make_pair(string(record.licence), slot));
+            stampVehicleIndexes();
+            return timer.result(data.good());
         }
-        
-        return false;
     } catch (const exception& e) {
         cerr << "Exception in FileIOforVehicle::saveVehicleWithData(): " << e.what() << endl;
-        return false;
+        return timer.result(false);
     }
 }
 
-bool FileIOforVehicle::deleteVehicle(const string &licence) {
+bool FileIOforVehicle::saveVehicles(const vector<Vehicle> &vehicles) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::saveVehicles");
+    LatencyTimer timer(stat);
     if (!data.is_open()) {
-        return false;
+        return timer.result(false);
     }
     
     try {
-        // Read all records except the one to delete
-        vector<VehicleRecord> records;
-        data.clear();
-        data.seekg(0, ios::beg);
+        vector<VehicleRecord> all;
+        readAllRecords(data, all);
         
-        VehicleRecord record;
-        while (data.read(reinterpret_cast<char*>(&record), sizeof(VehicleRecord))) {
-            if (string(record.licence) != licence) {
-                records.push_back(record);
+        // Hash the batch's plates (truncated as the records store
+        // them) and find their slots in one pass over the file
+        const size_t NOT_ON_FILE = static_cast<size_t>(-1);
+        unordered_map<string, size_t> slotOf;
+        // Loop goal: Mark each plate in the batch as not yet on file
+        for (const auto& vehicle : vehicles) {
+            slotOf.insert(make_pair(vehicle.getLicense().substr(0, 10), NOT_ON_FILE));
+        }
+        // Loop goal: Record the slot of each batch plate on file, first one wins
+        for (size_t i = 0; i < all.size(); ++i) {
+            unordered_map<string, size_t>::iterator hit =
+                slotOf.find(string(all[i].licence, strnlen(all[i].licence, sizeof(all[i].licence))));
+            if (hit != slotOf.end() && hit->second == NOT_ON_FILE) {
+                hit->second = i;
             }
         }
+        size_t existing = all.size();
+        
+        vector<PhoneIndexEntry> phoneChanges;
+        vector<pair<string, size_t> > added;
+        vector<size_t> updated;
+        // Loop goal: Overwrite or append each vehicle in memory
+        for (const auto& vehicle : vehicles) {
+            VehicleRecord record = vehicleToBinaryRecord(vehicle, vehicle.getLicense(), vehicle.getPhone());
+            string licence(record.licence);
+            unordered_map<string, size_t>::iterator slot = slotOf.find(licence);
+            if (slot->second != NOT_ON_FILE) {
+                VehicleRecord &old = all[slot->second];
+                if (phoneKey(old.phone) != phoneKey(record.phone)) {
+                    phoneChanges.push_back(makePhoneEntry(phoneKey(old.phone), licence, false));
+                    phoneChanges.push_back(makePhoneEntry(phoneKey(record.phone), licence, true));
+                }
+                old = record;
+                if (slot->second < existing) {
+                    updated.push_back(slot->second);
+                }
+            } else {
+                slot->second = all.size();
+                all.push_back(record);
+                phoneChanges.push_back(makePhoneEntry(phoneKey(record.phone), licence, true));
+                added.push_back(make_pair(licence, slot->second));
+            }
+        }
+        
+        data.clear();
+        // Loop goal: Overwrite each updated record in its own slot
+        for (size_t slot : updated) {
+            writeRecordAt(data, slot, all[slot]);
+        }
+        // New records go on the end in one write
+        vector<VehicleRecord> appended(all.begin() + existing, all.end());
+        data.seekp(0, ios::end);
+        countIO(IO_SEEKS);
+        writeAllRecords(data, appended);
+        flushRecords(data);
+        
+        appendPhoneEntries(phoneChanges);
+        // Loop goal: Add each new plate to the trie and slots
+        for (const auto& plate : added) {
+            plateTrie.insert(plate.first);
+            plateSlots.insert(plate);
+        }
+        stampVehicleIndexes();
+        return timer.result(data.good());
+    } catch (const exception& e) {
+        cerr << "Exception in FileIOforVehicle::saveVehicles(): " << e.what() << endl;
+        return timer.result(false);
+    }
+}
+
+bool FileIOforVehicle::bulkLoad(const vector<Vehicle> &vehicles) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::bulkLoad");
+    LatencyTimer timer(stat);
+    if (data.is_open()) {
+        return timer.result(false);
+    }
+    
+    try {
+        vector<VehicleRecord> records;
+        records.reserve(vehicles.size());
+        // Loop goal: Convert each vehicle to its record
+        for (const auto& vehicle : vehicles) {
+            records.push_back(vehicleToBinaryRecord(vehicle, vehicle.getLicense(), vehicle.getPhone()));
+        }
+        ofstream out(VEHICLE_DATA_FILE, ios::out | ios::binary | ios::trunc);
+        writeAllRecords(out, records);
+        out.close();
+        
+        // The phone index and trie describe the old file: drop them
+        // so the next open() rebuilds both from the new one
+        remove(PHONE_INDEX_FILE.c_str());
+        phoneIndexLoaded = false;
+        plateTrieLoaded = false;
+        return timer.result(!out.fail());
+    } catch (const exception& e) {
+        cerr << "Exception in FileIOforVehicle::bulkLoad(): " << e.what() << endl;
+        return timer.result(false);
+    }
+}
+
+bool FileIOforVehicle::deleteVehicle(const string &licence) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::deleteVehicle");
+    LatencyTimer timer(stat);
+    if (!data.is_open()) {
+        return timer.result(false);
+    }
+    
+    try {
+        // Read all records except the one to delete
+        vector<VehicleRecord> all;
+        readAllRecords(data, all);
+        
+        vector<VehicleRecord> records = parallelFilter(all, [&](const VehicleRecord& record) {
+            return strncmp(record.licence, licence.c_str(), sizeof(record.licence)) != 0;
+        });
         
         // Close and reopen file to truncate
         data.close();
         data.open(VEHICLE_DATA_FILE, ios::out | ios::binary | ios::trunc);
         
         // Write back all records except the deleted one
-        for (const auto& rec : records) {
-            data.write(reinterpret_cast<const char*>(&rec), sizeof(VehicleRecord));
-        }
+        writeAllRecords(data, records);
         
         data.close();
         
         // Reopen in read/write mode
         data.open(VEHICLE_DATA_FILE, ios::in | ios::out | ios::binary);
+        countIO(IO_REOPENS);
+        
+        // The records after the deleted one moved down a slot
+        indexPlateSlots(records);
+        // Loop goal: Drop each deleted record from the phone index and plate trie
+        for (const auto& record : all) {
+            if (strncmp(record.licence, licence.c_str(), sizeof(record.licence)) == 0) {
+                appendPhoneEntry(record.phone, record.licence, false);
+                plateTrie.erase(string(record.licence, strnlen(record.licence, sizeof(record.licence))));
+            }
+        }
+        stampVehicleIndexes();
         
         return true;
     } catch (const exception& e) {
         cerr << "Exception in FileIOforVehicle::deleteVehicle(): " << e.what() << endl;
-        return false;
+        return timer.result(false);
     }
 }
 
 bool FileIOforVehicle::getVehicleWithData(const string &licence, 
                                           Vehicle &vehicle, 
                                           string &phone) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::getVehicleWithData");
+    LatencyTimer timer(stat);
     if (!data.is_open()) {
         return false;
     }
     
     try {
-        // Reset file position
-        data.clear();
-        data.seekg(0, ios::beg);
-        
         VehicleRecord record;
-        while (data.read(reinterpret_cast<char*>(&record), sizeof(VehicleRecord))) {
-            if (string(record.licence) == licence) {
-                string licenceStr;
-                vehicle = binaryRecordToVehicle(record, licenceStr, phone);
-                return true;
-            }
+        size_t slot;
+        if (!readPlateRecord(data, licence, record, slot)) {
+            return false;
         }
-        
-        return false;
+        string licenceStr;
+        vehicle = binaryRecordToVehicle(record, licenceStr, phone);
+        return true;
     } catch (const exception& e) {
         cerr << "Exception in FileIOforVehicle::getVehicleWithData(): " << e.what() << endl;
         return false;
     }
 }
+
+vector<string> FileIOforVehicle::getPlatesForPhone(const string &phone) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::getPlatesForPhone");
+    LatencyTimer timer(stat);
+    vector<string> plates;
+    
+    if (!data.is_open()) {
+        return plates;
+    }
+    
+    unordered_map<string, set<string> >::const_iterator found = phoneIndex.find(phoneKey(phone));
+    if (found != phoneIndex.end()) {
+        plates.assign(found->second.begin(), found->second.end());
+    }
+    return plates;
+}
+
+vector<ReservationRecord> FileIOforVehicle::getUpcomingForPhone(const string &phone) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::getUpcomingForPhone");
+    LatencyTimer timer(stat);
+    vector<ReservationRecord> upcoming;
+    vector<string> plates = getPlatesForPhone(phone);
+    
+    // Loop goal: Gather each plate's reservations that are not yet on board
+    for (const auto& plate : plates) {
+        vector<ReservationRecord> reservations = getAllWithVehicle(plate);
+        for (const auto& reservation : reservations) {
+            if (!reservation.onboard) {
+                upcoming.push_back(reservation);
+            }
+        }
+    }
+    return upcoming;
+}
+
+vector<string> FileIOforVehicle::findPlatesWithPrefix(const string &prefix, size_t limit) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::findPlatesWithPrefix");
+    LatencyTimer timer(stat);
+    if (!data.is_open()) {
+        return vector<string>();
+    }
+    return plateTrie.withPrefix(prefix, limit);
+}
+
+vector<PlateMatch> FileIOforVehicle::findSimilarPlates(const string &plate, int maxDistance,
+                                                      size_t limit) {
+    static LatencyStat &stat = latencyStat("FileIOforVehicle::findSimilarPlates");
+    LatencyTimer timer(stat);
+    if (!data.is_open()) {
+        return vector<PlateMatch>();
+    }
+    return plateTrie.withinDistance(plate, maxDistance, limit);
+}
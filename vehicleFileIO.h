@@ -22,6 +22,13 @@
 // Rev. 2 - 2025/08/05 - James Nguyen
 //          - Finalized interface and aligned with .cpp
 // implementation.
+// Rev. 3 - 2026/10/18 - Group 19
+//          - Added getVehicles() for one-pass multi-plate lookup.
+//          - Added getManifest() reservation/vehicle hash join.
+//          - Added the persisted phone index and phone lookups.
+//          - Added prefix and fuzzy plate searches.
+//          - Added saveVehicles() batch save.
+//          - Added bulkLoad() for generated data.
 //************************************************************
 // in: Represents input parameter
 // out: Represents output parameter
@@ -33,7 +40,23 @@
 #include <fstream>
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include "vehicle.h"
+#include "plateTrie.h"
+#include "reservationFileIO.h"
+
+//--------------------------------------------------
+// One reservation on a sailing joined with its vehicle's details.
+struct ManifestRow
+{
+    std::string licensePlate; // Vehicle license plate
+    bool onboard;             // True if checked in
+    bool registered;          // False if the plate is not in the vehicle file
+    std::string phone;        // Contact phone ("N/A" if not registered)
+    bool isSpecial;           // Special vehicle flag (false if not registered)
+    float length;             // Length in meters (0 if not registered)
+    float height;             // Height in meters (0 if not registered)
+};
 
 // Helper for navigating persistent Vehicle records.
 class FileIOforVehicle
@@ -64,6 +87,53 @@ public:
     // Returns a Vehicle object populated from file.
     Vehicle getVehicle(const std::string &licence);
 
+    // Retrieves several Vehicles by license in a single pass
+    // over the data file.
+    // in:  licences – license strings to retrieve
+    // Returns a map from license to Vehicle for those found.
+    std::unordered_map<std::string, Vehicle> getVehicles(
+        const std::vector<std::string> &licences);
+
+    // Joins every reservation on a sailing with its vehicle in
+    // one read of the vehicle file, hashing whichever side is
+    // smaller and probing it with the other.
+    // in:  sailingID – sailing whose reservations to list
+    // Returns one row per reservation, in reservation file order.
+    std::vector<ManifestRow> getManifest(const std::string &sailingID);
+
+    // Looks up the plates registered to a phone number in the
+    // phone index (kept in phoneIndex.dat and updated by
+    // saveVehicleWithData() and deleteVehicle()). Punctuation in
+    // the number is ignored.
+    // in:  phone – phone number to look up
+    // Returns the plates in ascending order (empty if none).
+    std::vector<std::string> getPlatesForPhone(const std::string &phone);
+
+    // Retrieves every reservation not yet checked in for the
+    // vehicles registered to a phone number. The reservation
+    // store must be open.
+    // in:  phone – phone number to look up
+    // Returns the reservations grouped by plate.
+    std::vector<ReservationRecord> getUpcomingForPhone(const std::string &phone);
+
+    // Lists plates starting with the given characters, ignoring
+    // case, from the in-memory plate trie.
+    // in:  prefix – leading characters of the plate
+    // in:  limit – maximum results (0 = no limit)
+    // Returns the plates in ascending order.
+    std::vector<std::string> findPlatesWithPrefix(const std::string &prefix,
+                                                  size_t limit = 20);
+
+    // Lists plates within a few typing errors of the given one
+    // (insertions, deletions or substitutions, ignoring case).
+    // in:  plate – plate as typed or misread
+    // in:  maxDistance – largest edit distance to accept
+    // in:  limit – maximum results (0 = no limit)
+    // Returns the matches closest first.
+    std::vector<PlateMatch> findSimilarPlates(const std::string &plate,
+                                              int maxDistance = 2,
+                                              size_t limit = 20);
+
     // Saves a Vehicle record to the data file.
     // in:  v – Vehicle object to persist
     // Returns true if successful.
@@ -79,6 +149,22 @@ public:
                             const std::string &licence, 
                             const std::string &phone);
 
+    // Saves or updates a batch of vehicles (plate and phone taken
+    // from each Vehicle) with one read and one write of the data
+    // file. Existing plates are overwritten in place; new ones are
+    // appended.
+    // in:  vehicles – Vehicle objects to persist
+    // Returns true if successful.
+    bool saveVehicles(const std::vector<Vehicle> &vehicles);
+
+    // Replaces the vehicle file with the given vehicles in one
+    // write, for loading generated data. Must be called while
+    // closed; the phone index and plate trie are rebuilt by the
+    // next open().
+    // in:  vehicles – Vehicle objects, in file order
+    // Returns false if open or the write fails.
+    bool bulkLoad(const std::vector<Vehicle> &vehicles);
+
     // Deletes a vehicle record by license plate.
     // in:  licence – license plate string to delete
     // Returns true if successful.
@@ -0,0 +1,35 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+// Declares the console screens for adding and editing a
+// vehicle. They prompt on cin/cout and call the vehicle
+// operations in libfrss to do the work.
+//************************************************************
+// USAGE:
+// - Part of the console front end; called from the UI menus.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Moved the vehicle prompts out of vehicle.cpp.
+//************************************************************
+// in: Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef VEHICLE_MENU_H
+#define VEHICLE_MENU_H
+
+#include <string>
+
+// Handles adding a vehicle through user interface
+// Returns true if successful, false if cancelled or failed
+bool addVehicleFromUI();
+
+// Handles editing a vehicle through user interface
+// in: licencePlate – license plate of vehicle to edit
+// Returns true if successful, false if cancelled or failed
+bool editVehicleFromUI(const std::string& licencePlate);
+
+#endif // VEHICLE_MENU_H
@@ -0,0 +1,539 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Implements the synthetic workload generator declared in
+//   workloadGenerator.h. Everything is decided in memory first
+//   (sailing counters and remaining lane space included), then
+//   each data file is written with a single bulk write.
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial generator with bulk loads of each store.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Config checks moved to workloadConfigValid().
+//          - phoneDraw() returns 10 digits with no dashes.
+//************************************************************
+
+#include "workloadGenerator.h"
+#include "reservation.h"
+#include "recordIO.h"
+#include "reservationFileIO.h"
+#include "sailing.h"
+#include "sailingFileIO.h"
+#include "vehicle.h"
+#include "vehicleFileIO.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+//--------------------------------------------------
+// Terminal codes used first, busiest first; further terminals
+// get generated codes
+static const char *const NAMED_TERMINALS[] = {
+    "TSA", "SWB", "HSB", "DUK", "NAN", "LNG", "FUL", "CMX", "PWR", "TEX"
+};
+const size_t NAMED_TERMINAL_COUNT = sizeof(NAMED_TERMINALS) / sizeof(NAMED_TERMINALS[0]);
+
+// Three-letter codes available (26^3)
+const size_t TERMINAL_CODES = 17576;
+
+// Unused departure slots kept when terminals are added, so the
+// weighted choice still has something to choose between
+const double SLOT_HEADROOM = 1.25;
+
+//--------------------------------------------------
+// A vessel of the fleet. Busier sailings get bigger vessels.
+struct FleetVessel
+{
+    const char *name; // vessel name
+    int lcll;         // low ceiling lane length (m)
+    int hcll;         // high ceiling lane length (m)
+};
+
+static const FleetVessel FLEET[] = {
+    { "Spirit of Vancouver", 2400, 900 },
+    { "Coastal Celebration", 1800, 700 },
+    { "Queen of Oak Bay", 1200, 450 },
+    { "Island Voyager", 600, 240 },
+    { "Wave Dancer", 300, 120 },
+    { "Coastal Runner", 111, 222 }
+};
+const size_t FLEET_SIZE = sizeof(FLEET) / sizeof(FLEET[0]);
+
+// Area codes handed out to generated phone numbers
+static const char *const AREA_CODES[] = { "604", "778", "250", "236" };
+const size_t AREA_CODE_COUNT = sizeof(AREA_CODES) / sizeof(AREA_CODES[0]);
+
+// Plates are a permutation of 0 .. MAX_GENERATED_VEHICLES - 1:
+// index * PLATE_STRIDE + PLATE_OFFSET (mod the maximum). The
+// stride shares no factor with 2^6 * 5^3 * 13^3, so no repeats.
+const unsigned long long PLATE_STRIDE = 7919;
+const unsigned long long PLATE_OFFSET = 1234567;
+
+// Reservation file, as opened by the reservation module's initialize()
+const char *const RESERVATION_DATA_FILE = "reservation.dat";
+
+// Sailings tried for one booking before it is dropped
+const int BOOKING_ATTEMPTS = 8;
+
+WorkloadConfig::WorkloadConfig()
+    : seed(276),
+      sailings(1000),
+      vehicles(5000),
+      reservations(10000),
+      terminals(NAMED_TERMINAL_COUNT),
+      days(31),
+      terminalSkew(0.8),
+      specialRatio(0.15),
+      bookingSkew(1.0),
+      onboardRatio(0.2),
+      sharedPhoneRatio(0.1)
+{
+    // Commuter profile: no sailings overnight, peaks at 7-9 and 15-18
+    static const double PROFILE[24] = {
+        0, 0, 0, 0, 0, 1, 3, 6, 6, 5, 3, 3,
+        3, 3, 4, 5, 6, 6, 5, 3, 2, 1, 1, 0.5
+    };
+    std::copy(PROFILE, PROFILE + 24, hourWeights);
+}
+
+//--------------------------------------------------
+// Function: unitDraw
+//--------------------------------------------------
+// Returns a value in [0, 1). The engine's output is fixed by the
+// standard; the library distributions are not, so they are not
+// used and the files are the same on every platform.
+static double unitDraw(std::mt19937 &rng)
+{
+    return rng() / 4294967296.0;
+}
+
+//--------------------------------------------------
+// Function: indexDraw
+//--------------------------------------------------
+// Returns a value in [0, n), n < 2^32.
+static size_t indexDraw(std::mt19937 &rng, size_t n)
+{
+    return static_cast<size_t>((static_cast<unsigned long long>(rng()) * n) >> 32);
+}
+
+//--------------------------------------------------
+// Function: rangeDraw
+//--------------------------------------------------
+// Returns a dimension in [low, high] rounded to 0.1 m.
+static float rangeDraw(std::mt19937 &rng, double low, double high)
+{
+    return static_cast<float>(std::floor((low + unitDraw(rng) * (high - low)) * 10.0 + 0.5) / 10.0);
+}
+
+//--------------------------------------------------
+// Function: letterCode
+//--------------------------------------------------
+// Spells 0 .. 17575 as three capital letters.
+static std::string letterCode(size_t value)
+{
+    std::string code(3, 'A');
+    code[0] = static_cast<char>('A' + value / 676 % 26);
+    code[1] = static_cast<char>('A' + value / 26 % 26);
+    code[2] = static_cast<char>('A' + value % 26);
+    return code;
+}
+
+//--------------------------------------------------
+// Function: terminalCodes
+//--------------------------------------------------
+// Returns 'count' distinct terminal codes, the named ones first.
+static std::vector<std::string> terminalCodes(size_t count)
+{
+    std::vector<std::string> codes;
+    std::set<std::string> used;
+    // Loop goal: Take the named terminals first
+    for (size_t i = 0; i < NAMED_TERMINAL_COUNT && codes.size() < count; ++i)
+    {
+        codes.push_back(NAMED_TERMINALS[i]);
+        used.insert(NAMED_TERMINALS[i]);
+    }
+    // Loop goal: Fill up with scattered generated codes (the
+    // stride is coprime with 26^3, so each code comes up once)
+    for (size_t k = 0; codes.size() < count && k < TERMINAL_CODES; ++k)
+    {
+        std::string code = letterCode((k * 7919 + 4242) % TERMINAL_CODES);
+        if (used.insert(code).second)
+            codes.push_back(code);
+    }
+    return codes;
+}
+
+//--------------------------------------------------
+// Function: plateFor
+//--------------------------------------------------
+// Returns the plate of vehicle i, three letters then three digits.
+static std::string plateFor(size_t i)
+{
+    unsigned long long value = (i * PLATE_STRIDE + PLATE_OFFSET) % MAX_GENERATED_VEHICLES;
+    char digits[8];
+    std::snprintf(digits, sizeof(digits), "%03u", static_cast<unsigned>(value % 1000));
+    return letterCode(static_cast<size_t>(value / 1000)) + digits;
+}
+
+//--------------------------------------------------
+// Function: phoneDraw
+//--------------------------------------------------
+// Returns a 10-digit phone number such as 6045551234, the form
+// the UI accepts.
+static std::string phoneDraw(std::mt19937 &rng)
+{
+    char phone[16];
+    std::snprintf(phone, sizeof(phone), "%s%03u%04u",
+                  AREA_CODES[indexDraw(rng, AREA_CODE_COUNT)],
+                  static_cast<unsigned>(200 + indexDraw(rng, 800)),
+                  static_cast<unsigned>(indexDraw(rng, 10000)));
+    return phone;
+}
+
+//--------------------------------------------------
+// Function: shuffle
+//--------------------------------------------------
+// Fisher-Yates shuffle driven by indexDraw() (std::shuffle is
+// not the same on every platform).
+static void shuffle(std::vector<size_t> &values, std::mt19937 &rng)
+{
+    // Loop goal: Swap each position with a random earlier one
+    for (size_t i = values.size(); i > 1; --i)
+    {
+        std::swap(values[i - 1], values[indexDraw(rng, i)]);
+    }
+}
+
+//--------------------------------------------------
+// Per-sailing state while bookings are placed
+struct GeneratedSailing
+{
+    std::string sailingID;
+    size_t vessel;   // index into FLEET
+    float lrl;       // remaining low ceiling length
+    float hrl;       // remaining high ceiling length
+    int reserved;
+    int special;
+    int onboard;
+    float revenue;
+};
+
+//--------------------------------------------------
+// Function: generateSailings
+//--------------------------------------------------
+// Picks distinct departure slots (terminal, day, hour), each with
+// chance proportional to terminal weight times hour weight, and
+// returns them in timetable order. Adds terminals if the config
+// has too few for the sailing count. Returns false if the
+// sailings cannot fit.
+static bool generateSailings(const WorkloadConfig &config, std::mt19937 &rng,
+                             std::vector<GeneratedSailing> &sailings, size_t &terminalCount)
+{
+    std::vector<int> hours;
+    // Loop goal: Keep the hours that have departures
+    for (int h = 0; h < 24; ++h)
+    {
+        if (config.hourWeights[h] > 0)
+            hours.push_back(h);
+    }
+    terminalCount = std::max<size_t>(config.terminals, 1);
+    if (config.sailings == 0)
+        return true;
+    if (hours.empty())
+        return false;
+
+    size_t perTerminal = static_cast<size_t>(config.days) * hours.size();
+    size_t needed = static_cast<size_t>(std::ceil(config.sailings * SLOT_HEADROOM / perTerminal));
+    terminalCount = std::min(TERMINAL_CODES, std::max(terminalCount, needed));
+    size_t slotCount = terminalCount * perTerminal;
+    if (slotCount < config.sailings)
+        return false;
+    std::vector<std::string> codes = terminalCodes(terminalCount);
+
+    // Weighted sampling without replacement: each slot gets the key
+    // -ln(u) / weight and the smallest keys win
+    std::vector<std::pair<double, size_t>> keys(slotCount);
+    // Loop goal: Key each slot, numbered in timetable order
+    // (day, then hour, then terminal)
+    for (size_t slot = 0; slot < slotCount; ++slot)
+    {
+        size_t terminal = slot % terminalCount;
+        int hour = hours[slot / terminalCount % hours.size()];
+        double weight = config.hourWeights[hour] /
+                        std::pow(static_cast<double>(terminal + 1), config.terminalSkew);
+        keys[slot] = std::make_pair(-std::log(1.0 - unitDraw(rng)) / weight, slot);
+    }
+    std::nth_element(keys.begin(), keys.begin() + (config.sailings - 1), keys.end());
+    keys.resize(config.sailings);
+
+    std::vector<size_t> chosen(keys.size());
+    // Loop goal: Collect the chosen slot numbers
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        chosen[i] = keys[i].second;
+    }
+    std::sort(chosen.begin(), chosen.end());
+
+    sailings.resize(chosen.size());
+    // Loop goal: Name each chosen slot TTT-DD-HH
+    for (size_t i = 0; i < chosen.size(); ++i)
+    {
+        size_t slot = chosen[i];
+        char id[16];
+        std::snprintf(id, sizeof(id), "%s-%02u-%02d", codes[slot % terminalCount].c_str(),
+                      static_cast<unsigned>(slot / terminalCount / hours.size() + 1),
+                      hours[slot / terminalCount % hours.size()]);
+        GeneratedSailing &sailing = sailings[i];
+        sailing.sailingID = id;
+        sailing.vessel = FLEET_SIZE - 1;
+        sailing.reserved = 0;
+        sailing.special = 0;
+        sailing.onboard = 0;
+        sailing.revenue = 0.0f;
+    }
+    return true;
+}
+
+//--------------------------------------------------
+// Function: generateVehicles
+//--------------------------------------------------
+// Builds the vehicles. Special ones are either tall (over 2 m)
+// or long (over 7 m); regular ones fit the standard 7 m x 2 m.
+static void generateVehicles(const WorkloadConfig &config, std::mt19937 &rng,
+                             std::vector<Vehicle> &vehicles, size_t &specials)
+{
+    vehicles.resize(config.vehicles);
+    specials = 0;
+    std::string phone;
+    // Loop goal: Give each vehicle a plate, phone and dimensions
+    for (size_t i = 0; i < vehicles.size(); ++i)
+    {
+        if (i == 0 || unitDraw(rng) >= config.sharedPhoneRatio)
+            phone = phoneDraw(rng);
+
+        float length, height;
+        if (unitDraw(rng) < config.specialRatio)
+        {
+            ++specials;
+            if (unitDraw(rng) < 0.5)
+            {
+                length = rangeDraw(rng, 5.0, 12.0);
+                height = rangeDraw(rng, 2.1, 4.5);
+            }
+            else
+            {
+                length = rangeDraw(rng, 7.5, 20.0);
+                height = rangeDraw(rng, 1.5, 2.0);
+            }
+        }
+        else
+        {
+            length = rangeDraw(rng, 3.5, 7.0);
+            height = rangeDraw(rng, 1.4, 2.0);
+        }
+        vehicles[i].initialize(plateFor(i).c_str(), phone.c_str(), length, height);
+    }
+}
+
+//--------------------------------------------------
+// Function: generateReservations
+//--------------------------------------------------
+// Books random vehicles on sailings drawn by popularity (a Zipf
+// law over a random ranking), taking deck space exactly like
+// addReservation() does. A booking that finds no room after a
+// few sailings is dropped. Busier sailings get bigger vessels.
+static void generateReservations(const WorkloadConfig &config, std::mt19937 &rng,
+                                 std::vector<GeneratedSailing> &sailings,
+                                 const std::vector<Vehicle> &vehicles,
+                                 std::vector<ReservationRecord> &records,
+                                 WorkloadSummary &summary)
+{
+    size_t count = sailings.size();
+    std::vector<size_t> byRank(count);
+    // Loop goal: Start from sailing order, then shuffle into a ranking
+    for (size_t i = 0; i < count; ++i)
+    {
+        byRank[i] = i;
+    }
+    shuffle(byRank, rng);
+
+    std::vector<double> cumulative(count);
+    double total = 0.0;
+    // Loop goal: Give each rank its vessel and cumulative popularity
+    for (size_t rank = 0; rank < count; ++rank)
+    {
+        GeneratedSailing &sailing = sailings[byRank[rank]];
+        sailing.vessel = rank * FLEET_SIZE / count;
+        sailing.lrl = static_cast<float>(FLEET[sailing.vessel].lcll);
+        sailing.hrl = static_cast<float>(FLEET[sailing.vessel].hcll);
+        total += 1.0 / std::pow(static_cast<double>(rank + 1), config.bookingSkew);
+        cumulative[rank] = total;
+    }
+
+    if (count == 0 || vehicles.empty())
+    {
+        summary.rejected = config.reservations;
+        return;
+    }
+
+    std::unordered_set<unsigned long long> booked;
+    records.reserve(config.reservations);
+    summary.rejected = 0;
+    summary.onboard = 0;
+    // Loop goal: Place each booking on the first drawn sailing with room
+    for (size_t r = 0; r < config.reservations; ++r)
+    {
+        const Vehicle &vehicle = vehicles[indexDraw(rng, vehicles.size())];
+        size_t vehicleIndex = &vehicle - &vehicles[0];
+        bool placed = false;
+        // Loop goal: Draw sailings until one has room or the attempts run out
+        for (int attempt = 0; attempt < BOOKING_ATTEMPTS && !placed; ++attempt)
+        {
+            size_t rank = std::upper_bound(cumulative.begin(), cumulative.end(),
+                                           unitDraw(rng) * total) - cumulative.begin();
+            size_t index = byRank[std::min(rank, count - 1)];
+            GeneratedSailing &sailing = sailings[index];
+
+            float spacing = sailing.reserved == 0 ? 0.0f : VEHICLE_SPACING;
+            float lengthNeeded = (vehicle.isSpecial() ? vehicle.getLength() : REGULAR_LENGTH) + spacing;
+            float heightNeeded = vehicle.isSpecial() ? vehicle.getHeight() : REGULAR_HEIGHT;
+            if (sailing.lrl - lengthNeeded < 0 || sailing.hrl - heightNeeded < 0)
+                continue;
+            if (!booked.insert(static_cast<unsigned long long>(index) * vehicles.size() +
+                               vehicleIndex).second)
+                continue;
+
+            sailing.lrl -= lengthNeeded;
+            sailing.hrl -= heightNeeded;
+            ++sailing.reserved;
+            if (vehicle.isSpecial())
+                ++sailing.special;
+
+            ReservationRecord record;
+            std::memset(&record, 0, sizeof(record));
+            std::strncpy(record.licensePlate, vehicle.getLicense().c_str(), LICENSE_PLATE_MAX - 1);
+            std::strncpy(record.sailingID, sailing.sailingID.c_str(), SAILING_ID_MAX - 1);
+            record.onboard = unitDraw(rng) < config.onboardRatio;
+            if (record.onboard)
+            {
+                ++sailing.onboard;
+                ++summary.onboard;
+                sailing.revenue += calculateFare(vehicle.isSpecial(), vehicle.getLength(),
+                                                 vehicle.getHeight());
+            }
+            records.push_back(record);
+            placed = true;
+        }
+        if (!placed)
+            ++summary.rejected;
+    }
+}
+
+//--------------------------------------------------
+// Function: toSailing
+//--------------------------------------------------
+// Builds the Sailing for a generated one. Floats are printed with
+// nine significant digits so they read back unchanged.
+static Sailing toSailing(const GeneratedSailing &generated)
+{
+    const FleetVessel &vessel = FLEET[generated.vessel];
+    char line[160];
+    std::snprintf(line, sizeof(line), "%s|%s|%d|%d|%.9g|%.9g|%d|%d|%d|%.9g",
+                  generated.sailingID.c_str(), vessel.name, vessel.lcll, vessel.hcll,
+                  generated.lrl, generated.hrl, generated.reserved, generated.onboard,
+                  generated.special, generated.revenue);
+    Sailing sailing;
+    sailing.createSailing(line);
+    return sailing;
+}
+
+//--------------------------------------------------
+// Function: inRange
+//--------------------------------------------------
+// Returns true if 'value' lies between 'low' and 'high'; NaN
+// never does.
+static bool inRange(double value, double low, double high)
+{
+    return value >= low && value <= high;
+}
+
+bool workloadConfigValid(const WorkloadConfig &config)
+{
+    if (config.vehicles > MAX_GENERATED_VEHICLES || config.days < 1 || config.days > 31)
+        return false;
+    if (config.reservations > 0 && (config.sailings == 0 || config.vehicles == 0))
+        return false;
+    if (!inRange(config.specialRatio, 0.0, 1.0) || !inRange(config.onboardRatio, 0.0, 1.0) ||
+        !inRange(config.sharedPhoneRatio, 0.0, 1.0))
+        return false;
+    const double MAX_SKEW = std::numeric_limits<double>::max();
+    if (!inRange(config.terminalSkew, 0.0, MAX_SKEW) || !inRange(config.bookingSkew, 0.0, MAX_SKEW))
+        return false;
+    if (config.sailings == 0)
+        return true;
+
+    size_t hours = 0;
+    // Loop goal: Count the hours that have departures
+    for (int h = 0; h < 24; ++h)
+    {
+        if (config.hourWeights[h] > 0)
+            ++hours;
+    }
+    // generateSailings() adds terminals up to every code there is
+    return config.sailings <= TERMINAL_CODES * static_cast<size_t>(config.days) * hours;
+}
+
+bool generateWorkload(const WorkloadConfig &config, WorkloadSummary &summary)
+{
+    std::memset(&summary, 0, sizeof(summary));
+    if (!workloadConfigValid(config))
+        return false;
+
+    std::mt19937 rng(config.seed);
+    std::vector<GeneratedSailing> generated;
+    if (!generateSailings(config, rng, generated, summary.terminals))
+        return false;
+
+    std::vector<Vehicle> vehicles;
+    generateVehicles(config, rng, vehicles, summary.specialVehicles);
+
+    std::vector<ReservationRecord> records;
+    generateReservations(config, rng, generated, vehicles, records, summary);
+
+    std::vector<Sailing> sailings;
+    sailings.reserve(generated.size());
+    // Loop goal: Turn each generated sailing into a Sailing
+    for (size_t i = 0; i < generated.size(); ++i)
+    {
+        sailings.push_back(toSailing(generated[i]));
+    }
+    if (!sailingFileIO::bulkLoad(sailings))
+        return false;
+    summary.sailings = sailings.size();
+
+    FileIOforVehicle vehicleIO;
+    if (!vehicleIO.bulkLoad(vehicles))
+        return false;
+    summary.vehicles = vehicles.size();
+
+    // Reservation records are stored as they are
+    std::ofstream out(RESERVATION_DATA_FILE, std::ios::out | std::ios::binary | std::ios::trunc);
+    writeAllRecords(out, records);
+    out.close();
+    if (out.fail())
+        return false;
+    summary.reservations = records.size();
+    return true;
+}
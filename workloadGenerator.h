@@ -0,0 +1,98 @@
+// PROJECT: CMPT 276 – Ferry Reservation Software System
+// TEAM: Group 19
+// DATE: 2026/10/18
+//************************************************************
+// PURPOSE:
+//   Declares a synthetic workload generator that fills the
+//   sailing, vehicle and reservation stores with a realistic
+//   dataset of any size. Sailings follow terminal and hour of
+//   day profiles, a share of the vehicles are special, and
+//   bookings favour popular sailings. The same seed always
+//   produces the same files. Each data file is written whole in
+//   one go; the stores build their indexes when next opened.
+//************************************************************
+// USAGE:
+// - Call while the sailing, vehicle and reservation stores are
+//   closed. Existing data files are replaced.
+// - Fill in a WorkloadConfig (the defaults give a small dataset)
+//   and call generateWorkload().
+//************************************************************
+// REVISION HISTORY:
+// Rev. 1 - 2026/10/18 - Group 19
+//          - Initial generator with bulk loads of each store.
+// Rev. 2 - 2026/10/18 - Group 19
+//          - Added workloadConfigValid(), so callers can reject a
+//            config before touching the data files.
+//          - Generated phones are 10 digits, as the UI takes them.
+//************************************************************
+// in:  Represents input parameter
+// out: Represents output parameter
+//************************************************************
+
+#ifndef WORKLOAD_GENERATOR_H
+#define WORKLOAD_GENERATOR_H
+
+#include <cstddef>
+
+//--------------------------------------------------
+// Largest vehicle count the plate scheme (three letters, three
+// digits) can name without repeats.
+const size_t MAX_GENERATED_VEHICLES = 17576000;
+
+//--------------------------------------------------
+// What to generate. Ratios are between 0 and 1; skews are Zipf
+// exponents (0 = uniform, larger = more concentrated).
+struct WorkloadConfig
+{
+    unsigned seed;           // random seed; same seed, same files
+    size_t sailings;         // sailings to create
+    size_t vehicles;         // vehicles to register
+    size_t reservations;     // bookings to attempt
+    size_t terminals;        // departure terminals (more are added if
+                             // the sailings do not fit)
+    int days;                // days of the month used, from day 1 (1-31)
+    double terminalSkew;     // how much busier the main terminals are
+    double hourWeights[24];  // relative departures per hour of day
+    double specialRatio;     // share of vehicles that are special
+    double bookingSkew;      // how strongly bookings favour popular sailings
+    double onboardRatio;     // share of bookings already checked in
+    double sharedPhoneRatio; // share of vehicles sharing the previous
+                             // vehicle's phone (families, fleets)
+
+    // Sets the defaults: a small dataset with a commuter day profile.
+    WorkloadConfig();
+};
+
+//--------------------------------------------------
+// What was written.
+struct WorkloadSummary
+{
+    size_t sailings;        // sailings written
+    size_t terminals;       // terminals used
+    size_t vehicles;        // vehicles written
+    size_t specialVehicles; // of which special
+    size_t reservations;    // bookings written
+    size_t onboard;         // of which checked in
+    size_t rejected;        // bookings dropped because no sailing had room
+};
+
+//--------------------------------------------------
+// Returns true if 'config' can be generated: no more vehicles
+// than the plates can name, days from 1 to 31, sailings and
+// vehicles for any bookings, ratios from 0 to 1, skews of 0 or
+// more, and enough departure slots for the sailings.
+bool workloadConfigValid(
+    const WorkloadConfig &config // in: what to generate
+);
+
+//--------------------------------------------------
+// Generates the dataset described by 'config' and replaces the
+// data files with it. Returns false if the config is invalid
+// (see workloadConfigValid()), the sailing or vehicle store is
+// open or a write fails.
+bool generateWorkload(
+    const WorkloadConfig &config, // in: what to generate
+    WorkloadSummary &summary      // out: what was written
+);
+
+#endif // WORKLOAD_GENERATOR_H